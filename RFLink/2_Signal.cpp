@@ -8,35 +8,514 @@
 #include <Arduino.h>
 #include "2_Signal.h"
 #include "5_Plugin.h"
+#ifdef RF_HOST_SIM
+#include "2_Signal_Sim.h"
+#endif
 
-RawSignalStruct RawSignal = {0, 0, 0, 0, 0UL};
-unsigned long SignalCRC = 0L;   // holds the bitstream value for some plugins to identify RF repeats
-unsigned long SignalCRC_1 = 0L; // holds the previous SignalCRC (for mixed burst protocols)
+RawSignalStruct RawSignalPool[RAW_SIGNAL_POOL];                 // RF frames, recycled between capture and decode
+RawSignalStruct *RawSignalDecode = &RawSignalPool[0];           // frame offered to the plugins, aka RawSignal
+RawSignalStruct *RawSignalCapture = NULL;                       // frame being filled by FetchSignal()
 byte SignalHash = 0L;           // holds the processed plugin number
-byte SignalHashPrevious = 0L;   // holds the last processed plugin number
-unsigned long RepeatingTimer = 0L;
+PulseFeaturesStruct RawFeatures; // features of RawSignal, computed once before the plugins run
+uint32_t PulseMap[PULSE_MAP_WORDS + 1]; // short/long map of RawSignal, one spare word for PulseMapBits()
+int PulseMap_mid = -1;                  // threshold of PulseMap, -1 when it is not computed for this frame
+
+// *********************************************************************************
+// Frame ownership hand-off. Frames are never copied, only their pool index moves:
+// free list -> RawSignalCapture -> ready FIFO -> RawSignalDecode -> free list
+// *********************************************************************************
+byte FreeFrames[RAW_SIGNAL_POOL];
+byte FreeCount = 0;
+byte ReadyFrames[RAW_SIGNAL_POOL];
+byte ReadyFirst = 0;
+byte ReadyCount = 0;
+
+void InitFrames(void)
+{
+  for (byte x = 0; x < RAW_SIGNAL_POOL; x++)
+  {
+    RawSignalPool[x].Number = 0;
+    RawSignalPool[x].Time = 0UL;
+    FreeFrames[x] = RAW_SIGNAL_POOL - 1 - x; // frame 0 is handed out first
+  }
+  FreeCount = RAW_SIGNAL_POOL;
+  ReadyFirst = ReadyCount = 0;
+  RawSignalCapture = NULL;
+  RawSignalDecode = &RawSignalPool[0];
+}
+
+// Make sure FetchSignal() has a frame to fill
+boolean AcquireFrame(void)
+{
+  if (RawSignalCapture == NULL)
+  {
+    if (FreeCount == 0)
+      return false; // all frames wait for decode, edges stay in the ring meanwhile
+    RawSignalCapture = &RawSignalPool[FreeFrames[--FreeCount]];
+  }
+  return true;
+}
+
+// Capture is complete, hand the frame over to the decode side
+void QueueFrame(void)
+{
+  ReadyFrames[(ReadyFirst + ReadyCount++) % RAW_SIGNAL_POOL] = RawSignalCapture - RawSignalPool;
+  RawSignalCapture = NULL;
+#ifdef RF_HOST_SIM
+  SimFrames++;
+#endif
+}
+
+// Oldest completed frame becomes RawSignal
+boolean PopFrame(void)
+{
+  if (ReadyCount == 0)
+    return false;
+  RawSignalDecode = &RawSignalPool[ReadyFrames[ReadyFirst]];
+  ReadyFirst = (ReadyFirst + 1) % RAW_SIGNAL_POOL;
+  ReadyCount--;
+  return true;
+}
+
+// Decode is over, RawSignal can be captured again
+void ReleaseFrame(void)
+{
+  FreeFrames[FreeCount++] = RawSignalDecode - RawSignalPool;
+}
+
+// *********************************************************************************
+// Repeat suppression cache, see SignalRepeat() in 2_Signal.h
+// *********************************************************************************
+struct RepeatEntryStruct
+{
+  unsigned long Key;  // decoded bits, as chosen by the plugin
+  unsigned long Seen; // RawSignal.Time of the last packet with this key
+  unsigned int Hold;  // mSec. during which the key is a repeat, 0 when the entry is free
+  byte Id;            // plugin id
+};
+RepeatEntryStruct RepeatCache[REPEAT_CACHE_SIZE];
+byte RepeatLast = 0; // entry of the last SignalRepeat() call
+
+boolean SignalRepeat(unsigned long Key, unsigned int Hold_ms)
+{
+  unsigned long Now = RawSignal.Time;
+  byte Id = Plugin_id(SignalHash);
+  byte Oldest = 0;
+
+  for (byte x = 0; x < REPEAT_CACHE_SIZE; x++)
+  {
+    RepeatEntryStruct *Entry = &RepeatCache[x];
+    if (Entry->Hold && (Entry->Key == Key) && (Entry->Id == Id))
+    {
+      boolean Repeat = (Now - Entry->Seen < Entry->Hold);
+      Entry->Seen = Now;
+      Entry->Hold = Hold_ms;
+      RepeatLast = x;
+      return Repeat;
+    }
+    // free entries first, then the least recently seen one
+    if (RepeatCache[Oldest].Hold && ((Entry->Hold == 0) || (Now - Entry->Seen > Now - RepeatCache[Oldest].Seen)))
+      Oldest = x;
+  }
+  RepeatCache[Oldest].Key = Key;
+  RepeatCache[Oldest].Seen = Now;
+  RepeatCache[Oldest].Hold = Hold_ms;
+  RepeatCache[Oldest].Id = Id;
+  RepeatLast = Oldest;
+  return false;
+}
+
+// Last frame accepted by each of the plugins seen recently, whether they use SignalRepeat() or not
+struct DecodedEntryStruct
+{
+  unsigned long Seen; // RawSignal.Time of the last frame the plugin accepted
+  byte Id;            // plugin id, 0 when the entry is free
+};
+DecodedEntryStruct DecodedCache[REPEAT_CACHE_SIZE];
+
+void SignalDecoded(byte Id)
+{
+  unsigned long Now = RawSignal.Time;
+  byte Oldest = 0;
+
+  for (byte x = 0; x < REPEAT_CACHE_SIZE; x++)
+  {
+    DecodedEntryStruct *Entry = &DecodedCache[x];
+    if (Entry->Id == Id)
+    {
+      Entry->Seen = Now;
+      return;
+    }
+    // free entries first, then the least recently seen one
+    if (DecodedCache[Oldest].Id && ((Entry->Id == 0) || (Now - Entry->Seen > Now - DecodedCache[Oldest].Seen)))
+      Oldest = x;
+  }
+  DecodedCache[Oldest].Seen = Now;
+  DecodedCache[Oldest].Id = Id;
+}
+
+boolean SignalSeen(byte Id, unsigned int Within_ms)
+{
+  for (byte x = 0; x < REPEAT_CACHE_SIZE; x++)
+    if ((DecodedCache[x].Id == Id) && (RawSignal.Time - DecodedCache[x].Seen < Within_ms))
+      return true;
+  return false;
+}
+
+#ifdef SIGNAL_MEMO
+// *********************************************************************************
+// Decode memo: remotes and doorbells send 10..20 copies of a frame, and every copy went through
+// Plugin_001 and the dispatch until its plugin found it was a repeat. Once a frame is decoded,
+// its fingerprint is linked to the repeat cache entry the plugin used: a frame with the same
+// fingerprint while that entry holds would be thrown away by the plugin anyway.
+// *********************************************************************************
+struct MemoEntryStruct
+{
+  unsigned long Fingerprint; // PulseFingerprint() of the decoded frame, 0 when the entry is free
+  unsigned long Key;         // RepeatCache entry the plugin used, checked in case it was reused since
+  byte Repeat;
+  byte Id;
+};
+MemoEntryStruct MemoCache[SIGNAL_MEMO_FRAMES];
+byte MemoNext = 0;
+
+// Hash of the class of each pulse: glitch, short, long or gap, split halfway between the cluster
+// means of RawFeatures so that the jitter between copies does not change it. 0 when short and
+// long are closer than 1:2, where the classes are not clear: such frames are always decoded.
+unsigned long PulseFingerprint(void)
+{
+  unsigned long Hash = 2166136261UL; // FNV-1a
+  byte Pulse, Low, Mid, High;
+
+  if (RawFeatures.Ratio < 2)
+    return 0;
+  Low = RawFeatures.Short / 2;
+  Mid = (RawFeatures.Short + RawFeatures.Long) / 2;
+  High = (RawFeatures.Long > 0xAA) ? 0xFF : RawFeatures.Long + RawFeatures.Long / 2;
+  Hash = (Hash ^ (RawSignal.Number & 0xFF)) * 16777619UL;
+  for (int x = 2; x < RawSignal.Number; x++) // same pulses as PulseFeaturesCompute()
+  {
+    Pulse = RawSignal.Pulses[x];
+    Hash = (Hash ^ ((Pulse > Low) + (Pulse > Mid) + (Pulse > High))) * 16777619UL;
+  }
+  return Hash ? Hash : 1;
+}
+
+boolean SignalMemoCheck(unsigned long Fingerprint)
+{
+  if (Fingerprint == 0)
+    return false;
+  for (byte x = 0; x < SIGNAL_MEMO_FRAMES; x++)
+  {
+    MemoEntryStruct *Memo = &MemoCache[x];
+    if (Memo->Fingerprint != Fingerprint)
+      continue;
+    RepeatEntryStruct *Entry = &RepeatCache[Memo->Repeat];
+    if (!Entry->Hold || (Entry->Key != Memo->Key) || (Entry->Id != Memo->Id) || (RawSignal.Time - Entry->Seen >= Entry->Hold))
+    {
+      Memo->Fingerprint = 0; // the plugin would decode it as a new packet
+      return false;
+    }
+    Entry->Seen = RawSignal.Time; // as SignalRepeat() does on a repeat
+    SignalDecoded(Memo->Id);      // as PluginRXCall() does when the plugin accepts the frame
+    return true;
+  }
+  return false;
+}
+
+// After a successful decode: only frames that went through SignalRepeat() of the plugin that
+// decoded them (during this frame) are kept, plugins without repeat check see all copies.
+void SignalMemoStore(unsigned long Fingerprint)
+{
+  RepeatEntryStruct *Entry = &RepeatCache[RepeatLast];
+
+  if ((Fingerprint == 0) || !Entry->Hold || (Entry->Seen != RawSignal.Time) || (Entry->Id != Plugin_id(SignalHash)))
+    return;
+  for (byte x = 0; x < SIGNAL_MEMO_FRAMES; x++)
+    if (MemoCache[x].Fingerprint == Fingerprint)
+      return;
+  MemoCache[MemoNext].Fingerprint = Fingerprint;
+  MemoCache[MemoNext].Key = Entry->Key;
+  MemoCache[MemoNext].Repeat = RepeatLast;
+  MemoCache[MemoNext].Id = Entry->Id;
+  MemoNext = (MemoNext + 1) % SIGNAL_MEMO_FRAMES;
+}
+#endif
 
 /*********************************************************************************************/
 boolean ScanEvent(void)
 { // Deze routine maakt deel uit van de hoofdloop en wordt iedere 125uSec. doorlopen
-  unsigned long Timer = millis() + SCAN_HIGH_TIME_MS;
+  unsigned long Timer = RF_MILLIS() + SCAN_HIGH_TIME_MS;
+  boolean Decoded;
 
-  while (Timer > millis()) // || RepeatingTimer > millis())
+  while (Timer > RF_MILLIS())
   {
     // delay(1); // For Modem Sleep
-    if (FetchSignal())
+#if defined(RF_ISR_CAPTURE) && (defined(ESP32) || defined(ESP8266) || defined(RF_HOST_SIM))
+    while (FetchSignal()) // Assemble every frame already captured in background
+      ;
+#else
+    FetchSignal();
+#endif
+    while (PopFrame())
     { // RF: *** data start ***
-      if (PluginRXCall(0, 0))
-      { // Check all plugins to see which plugin can handle the received signal.
-        RepeatingTimer = millis() + SIGNAL_REPEAT_TIME_MS;
+#ifdef SIGNAL_COMBINE
+      int Number = RawSignal.Number;
+#endif
+      Decoded = PluginRXCall(0, 0); // Check all plugins to see which plugin can handle the received signal.
+#ifdef SIGNAL_COMBINE
+      if (!Decoded && (RawSignal.Number == Number)) // not translated by Plugin_001 on the way
+        Decoded = SignalCombine();
+#endif
+      ReleaseFrame();
+      if (Decoded)
         return true;
-      }
     }
+#if defined(RF_ISR_CAPTURE) && (defined(ESP32) || defined(ESP8266) || defined(RF_HOST_SIM))
+    if (EdgeTail == EdgeHead)
+    {               // Nothing left to assemble, edges keep being captured in background
+      RF_DELAY(1);  // For Modem Sleep
+      return false; // Give back hand to the main loop
+    }
+#endif
   } // while
   return false;
 }
 
-#if (defined(ESP32) || defined(ESP8266))
+#ifdef SIGNAL_COMBINE
+// ***********************************************************************************
+// Combining of repeated transmissions. Most sensors send the same frame 3 to 6 times.
+// Frames no plugin could decode are kept for a while. As soon as the current frame and
+// at least two kept ones look like copies of the same transmission (same length, same
+// clock, nearly the same short/long pattern), each pulse is replaced by the median of
+// its copies, which is a majority vote on short/long, and the plugins get a new try.
+// ***********************************************************************************
+struct CombineSlotStruct
+{
+  int Number;                       // RawSignal.Number of the kept frame, 0 = free slot
+  unsigned long Time;               // RF_MILLIS() when kept
+  byte Unit;                        // RawFeatures.Unit and Ratio of the kept frame
+  byte Ratio;                       //
+  byte Pulses[RAW_BUFFER_SIZE + 1]; // copy of RawSignal.Pulses
+};
+CombineSlotStruct CombineSlots[SIGNAL_COMBINE_FRAMES];
+
+// true when Slot holds a copy of the same transmission as RawSignal
+boolean SignalCombineMatch(const CombineSlotStruct *Slot, byte Mid)
+{
+  byte Diff = 0;
+  byte Tolerance = RawFeatures.Unit / 8 + 1;
+
+  if ((Slot->Number != RawSignal.Number) || (Slot->Ratio != RawFeatures.Ratio))
+    return false;
+  if ((Slot->Unit > RawFeatures.Unit + Tolerance) || (Slot->Unit + Tolerance < RawFeatures.Unit))
+    return false;
+  for (int x = 1; x < RawSignal.Number; x++)
+    if ((Slot->Pulses[x] > Mid) != (RawSignal.Pulses[x] > Mid))
+      if (++Diff > SIGNAL_COMBINE_DIFF)
+        return false;
+  return true;
+}
+
+boolean SignalCombine(void)
+{
+  unsigned long Now = RF_MILLIS();
+  byte Mid = (RawFeatures.Short + RawFeatures.Long) / 2;
+  byte Match[SIGNAL_COMBINE_FRAMES];
+  byte Count = 0;
+  byte Keep = 0;
+  byte Copies[SIGNAL_COMBINE_FRAMES] = {0}; // pulse x of the matching copies, sorted
+  byte Pulse;
+  byte s, i, j;
+  int x;
+
+  for (s = 0; s < SIGNAL_COMBINE_FRAMES; s++)
+  {
+    if (CombineSlots[s].Number && (Now - CombineSlots[s].Time > SIGNAL_COMBINE_MS))
+      CombineSlots[s].Number = 0; // too old to be a repeat of anything still on air
+    if (CombineSlots[s].Number == 0)
+      Keep = s;
+    else if (SignalCombineMatch(&CombineSlots[s], Mid))
+      Match[Count++] = s;
+  }
+
+  // Keep the current frame in a free slot, else in place of the oldest one
+  if (CombineSlots[Keep].Number)
+    for (s = 0; s < SIGNAL_COMBINE_FRAMES; s++)
+      if (Now - CombineSlots[s].Time > Now - CombineSlots[Keep].Time)
+        Keep = s;
+  for (i = 0; i < Count; i++)
+    if (Match[i] == Keep)
+      Match[i] = Match[--Count];
+  CombineSlots[Keep].Number = RawSignal.Number;
+  CombineSlots[Keep].Time = Now;
+  CombineSlots[Keep].Unit = RawFeatures.Unit;
+  CombineSlots[Keep].Ratio = RawFeatures.Ratio;
+  memcpy(CombineSlots[Keep].Pulses, RawSignal.Pulses, RawSignal.Number + 1);
+
+  if (Count < 2)
+    return false; // no majority with less than three copies
+  Match[Count++] = Keep;
+
+  // Median of the copies, pulse by pulse. Pulses[0] is left alone, plugins use it as a marker.
+  for (x = 1; x <= RawSignal.Number; x++)
+  {
+    for (i = 0; i < Count; i++)
+    { // insertion sort, Count is a handful
+      Pulse = CombineSlots[Match[i]].Pulses[x];
+      for (j = i; (j > 0) && (Copies[j - 1] > Pulse); j--)
+        Copies[j] = Copies[j - 1];
+      Copies[j] = Pulse;
+    }
+    RawSignal.Pulses[x] = Copies[(Count - 1) / 2];
+  }
+
+  if (!PluginRXCall(0, 0))
+    return false;
+  for (i = 0; i < Count; i++)
+    CombineSlots[Match[i]].Number = 0; // these copies are done with
+  return true;
+}
+#endif
+
+#if (defined(ESP32) || defined(ESP8266) || defined(RF_HOST_SIM))
+#ifdef RF_ISR_CAPTURE
+// ***********************************************************************************
+// Edges are timestamped by RF_ISR() and pushed in a single producer / single consumer
+// ring. Only the ISR moves EdgeHead, only the main loop moves EdgeTail, so no lock is needed.
+// Bit 0 of each timestamp holds the RX level right after the edge.
+// ***********************************************************************************
+volatile unsigned long EdgeRing[EDGE_RING_SIZE];
+volatile unsigned int EdgeHead = 0;
+volatile unsigned int EdgeTail = 0;
+volatile unsigned long EdgeOverflow = 0; // edges dropped because the ring was full
+
+#define EDGE_RING_MASK (EDGE_RING_SIZE - 1)
+#define EDGE_LEVEL(e) ((e)&1UL)
+// Preamble in samples, a gap longer than a byte can hold is kept as 0xFF
+#define EDGE_PREAMBLE(us) ((byte)(((us) < 0xFFUL * RAWSIGNAL_SAMPLE_RATE) ? ((us) / RAWSIGNAL_SAMPLE_RATE) : 0xFF))
+
+// Called from RF_ISR(), so it has to be in IRAM as well
+boolean IRAM_ATTR PushEdge(unsigned long Edge)
+{
+  unsigned int Head = EdgeHead;
+  unsigned int Next = (Head + 1) & EDGE_RING_MASK;
+
+  if (Next == EdgeTail)
+  { // Ring full, drop edge. Frame assembler will reject the broken frame.
+    EdgeOverflow++;
+    return false;
+  }
+  EdgeRing[Head] = Edge;
+  EdgeHead = Next; // publish only once the slot is written
+  return true;
+}
+
+#ifndef RF_HOST_SIM // edges are pushed by the simulated clock instead
+void IRAM_ATTR RF_ISR()
+{
+  PushEdge((RF_MICROS() & ~1UL) | RF_RX_LEVEL());
+}
+
+void setup_RF_ISR()
+{
+  EdgeHead = EdgeTail = 0;
+  attachInterrupt(digitalPinToInterrupt(PIN_RF_RX_DATA), RF_ISR, CHANGE);
+}
+#endif // RF_HOST_SIM
+
+// ***********************************************************************************
+boolean FetchSignal()
+{
+  // *********************************************************************************
+  static bool Capturing = false;
+  static unsigned long LastEdge;
+  static unsigned int RawCodeLength;
+  static bool Chained = false;
+  static byte Preamble;
+  unsigned long Edge;
+  unsigned long PulseLength_us;
+  boolean Ended = false;
+  // *********************************************************************************
+
+  if (!AcquireFrame())
+    return false; // no free frame yet, edges wait in the ring
+
+  if (Chained)
+  { // Previous frame ended on a preamble, start from there
+    RawCodeLength = 0;
+    RawSignalCapture->Pulses[RawCodeLength++] = Preamble;
+    Capturing = true;
+    Chained = false;
+  }
+
+  while (!Ended)
+  {
+    // ***   No edge yet: RX is idle ?   ***
+    if (EdgeTail == EdgeHead)
+    {
+      if (Capturing && ((RF_MICROS() - LastEdge) > SIGNAL_END_TIMEOUT_US))
+      { // Last level lasted too long, signal has stopped
+        RawSignalCapture->Pulses[RawCodeLength++] = SIGNAL_END_TIMEOUT_US / RAWSIGNAL_SAMPLE_RATE;
+        Ended = true;
+        break;
+      }
+      return false; // wait for more edges
+    }
+
+    Edge = EdgeRing[EdgeTail];
+    EdgeTail = (EdgeTail + 1) & EDGE_RING_MASK;
+    PulseLength_us = Edge - LastEdge; // duration of the level set by the previous edge (wrap safe)
+
+    if (!Capturing)
+    {
+      // ***   Scan for Preamble Pulse   ***
+      if ((EDGE_LEVEL(LastEdge) == LOW) && (PulseLength_us >= SIGNAL_MIN_PREAMBLE_US))
+      {
+        RawCodeLength = 0;
+        RawSignalCapture->Pulses[RawCodeLength++] = EDGE_PREAMBLE(PulseLength_us);
+        Capturing = true;
+      }
+    }
+    else if ((EDGE_LEVEL(Edge) == EDGE_LEVEL(LastEdge)) || (PulseLength_us < MIN_PULSE_LENGTH_US))
+    { // Missed edge (ring overflow) or too short Pulse
+      Capturing = false;
+    }
+    else if (PulseLength_us > SIGNAL_END_TIMEOUT_US)
+    { // Ending Pulse
+      RawSignalCapture->Pulses[RawCodeLength++] = SIGNAL_END_TIMEOUT_US / RAWSIGNAL_SAMPLE_RATE;
+      Ended = true;
+      // Same gap is also the preamble of the next repeat, which is already in the ring
+      Chained = (EDGE_LEVEL(LastEdge) == LOW) && (PulseLength_us >= SIGNAL_MIN_PREAMBLE_US);
+      Preamble = EDGE_PREAMBLE(PulseLength_us);
+    }
+    else
+    { // Store Pulse
+      RawSignalCapture->Pulses[RawCodeLength++] = PulseLength_us / RAWSIGNAL_SAMPLE_RATE;
+      if (RawCodeLength >= RAW_BUFFER_SIZE)
+        Ended = true;
+    }
+    LastEdge = Edge;
+  }
+
+  Capturing = false;
+  if (RawCodeLength >= MIN_RAW_PULSES)
+  {
+    RawSignalCapture->Pulses[RawCodeLength] = 0;  // Last element contains the timeout.
+    RawSignalCapture->Number = RawCodeLength - 1; // Number of received pulse times (pulsen *2)
+    RawSignalCapture->Multiply = RAWSIGNAL_SAMPLE_RATE;
+    RawSignalCapture->Time = RF_MILLIS(); // Time the RF packet was received (to keep track of retransmits
+    QueueFrame();
+    return true;
+  }
+  else
+  {
+    RawSignalCapture->Number = 0;
+  }
+
+  return false;
+}
+#else // RF_ISR_CAPTURE
 // ***********************************************************************************
 boolean FetchSignal()
 {
@@ -49,13 +528,16 @@ boolean FetchSignal()
   static const bool Start_Level = LOW;
   // *********************************************************************************
 
-#define RESET_SEEKSTART timeStartSeek_ms = millis();
-#define RESET_TIMESTART timeStartLoop_us = micros();
-#define CHECK_RF ((digitalRead(PIN_RF_RX_DATA) == Start_Level) ^ Toggle)
-#define CHECK_TIMEOUT ((millis() - timeStartSeek_ms) < SIGNAL_SEEK_TIMEOUT_MS)
-#define GET_PULSELENGTH PulseLength_us = micros() - timeStartLoop_us
+#define RESET_SEEKSTART timeStartSeek_ms = RF_MILLIS();
+#define RESET_TIMESTART timeStartLoop_us = RF_MICROS();
+#define CHECK_RF ((RF_RX_LEVEL() == Start_Level) ^ Toggle)
+#define CHECK_TIMEOUT ((RF_MILLIS() - timeStartSeek_ms) < SIGNAL_SEEK_TIMEOUT_MS)
+#define GET_PULSELENGTH PulseLength_us = RF_MICROS() - timeStartLoop_us
 #define SWITCH_TOGGLE Toggle = !Toggle
-#define STORE_PULSE RawSignal.Pulses[RawCodeLength++] = PulseLength_us / RAWSIGNAL_SAMPLE_RATE
+#define STORE_PULSE RawSignalCapture->Pulses[RawCodeLength++] = PulseLength_us / RAWSIGNAL_SAMPLE_RATE
+
+  if (!AcquireFrame())
+    return false; // no free frame, decode first
 
   // ***   Init Vars   ***
   Toggle = true;
@@ -123,21 +605,23 @@ boolean FetchSignal()
 
   if (RawCodeLength >= MIN_RAW_PULSES)
   {
-    RawSignal.Pulses[RawCodeLength] = 0;  // Last element contains the timeout.
-    RawSignal.Number = RawCodeLength - 1; // Number of received pulse times (pulsen *2)
-    RawSignal.Multiply = RAWSIGNAL_SAMPLE_RATE;
-    RawSignal.Time = millis(); // Time the RF packet was received (to keep track of retransmits
+    RawSignalCapture->Pulses[RawCodeLength] = 0;  // Last element contains the timeout.
+    RawSignalCapture->Number = RawCodeLength - 1; // Number of received pulse times (pulsen *2)
+    RawSignalCapture->Multiply = RAWSIGNAL_SAMPLE_RATE;
+    RawSignalCapture->Time = RF_MILLIS(); // Time the RF packet was received (to keep track of retransmits
     //Serial.print ("D");
     //Serial.print (RawCodeLength);
+    QueueFrame();
     return true;
   }
   else
   {
-    RawSignal.Number = 0;
+    RawSignalCapture->Number = 0;
   }
 
   return false;
 }
+#endif // RF_ISR_CAPTURE
 #endif
 // ***********************************************************************************
 
@@ -180,6 +664,9 @@ boolean FetchSignal()
   static boolean Ftoggle;
   static unsigned long numloops;
 
+  if (!AcquireFrame())
+    return false; // no free frame, decode first
+
   if ((*portInputRegister(Fport) & Fbit) == FstateMask)
   { // If there is a signal
     // If it is a repeating signal, chances are that we will be in this again in a very short time
@@ -220,20 +707,21 @@ boolean FetchSignal()
       if (PulseLength < MIN_PULSE_LENGTH_US)
         break; // Pulse length too short
       Ftoggle = !Ftoggle;
-      RawSignal.Pulses[RawCodeLength++] = PulseLength / (unsigned long)(RAWSIGNAL_SAMPLE_RATE); // store in RawSignal !!!!
+      RawSignalCapture->Pulses[RawCodeLength++] = PulseLength / (unsigned long)(RAWSIGNAL_SAMPLE_RATE); // store in RawSignal !!!!
     } while (RawCodeLength < RAW_BUFFER_SIZE && numloops <= maxloops);                          // For as long as there is space in the buffer, no timeout etc.
     if (RawCodeLength >= MIN_RAW_PULSES)
     {
-      RawSignal.Repeats = 0;                      // No repeats
-      RawSignal.Multiply = RAWSIGNAL_SAMPLE_RATE; // Sample size.
-      RawSignal.Number = RawCodeLength - 1;       // Number of received pulse times (pulsen *2)
-      RawSignal.Pulses[RawSignal.Number + 1] = 0; // Last element contains the timeout.
-      RawSignal.Time = millis();                  // Time the RF packet was received (to keep track of retransmits
+      RawSignalCapture->Repeats = 0;                              // No repeats
+      RawSignalCapture->Multiply = RAWSIGNAL_SAMPLE_RATE;         // Sample size.
+      RawSignalCapture->Number = RawCodeLength - 1;               // Number of received pulse times (pulsen *2)
+      RawSignalCapture->Pulses[RawSignalCapture->Number + 1] = 0; // Last element contains the timeout.
+      RawSignalCapture->Time = millis();                          // Time the RF packet was received (to keep track of retransmits
+      QueueFrame();
       return true;
     }
     else
     {
-      RawSignal.Number = 0;
+      RawSignalCapture->Number = 0;
     }
   }
   return false;
@@ -243,6 +731,237 @@ boolean FetchSignal()
 #endif
 // ***********************************************************************************
 
+/*********************************************************************************************\
+ * Frames built at another rate (Multiply) are brought back to RAWSIGNAL_SAMPLE_RATE before
+ * decoding, so that plugins can compare pulses with PULSE_FLOOR / PULSE_CEIL thresholds.
+ * Rare, a received frame is always at RAWSIGNAL_SAMPLE_RATE already.
+ \*********************************************************************************************/
+void RawSignalRescale(void)
+{
+  unsigned int Pulse;
+
+  if ((RawSignal.Multiply == RAWSIGNAL_SAMPLE_RATE) || (RawSignal.Multiply == 0))
+    return;
+
+  for (int x = 1; x <= RawSignal.Number; x++) // Pulses[0] is not a pulse
+  {
+    Pulse = ((unsigned int)RawSignal.Pulses[x] * RawSignal.Multiply) / RAWSIGNAL_SAMPLE_RATE;
+    RawSignal.Pulses[x] = (Pulse > 0xFF) ? 0xFF : Pulse;
+  }
+  RawSignal.Multiply = RAWSIGNAL_SAMPLE_RATE;
+}
+
+/*********************************************************************************************\
+ * Pulse features of RawSignal, computed once per frame so that plugins can reject in O(1)
+ * instead of each scanning Pulses[] again. Pulses[1] (start bit) and Pulses[Number]
+ * (end of frame gap) are left out, as the plugins do.
+ \*********************************************************************************************/
+void PulseFeaturesCompute(void)
+{
+  int x;
+  byte Pulse;
+  byte Min, Low, Limit;
+  byte Mid, Split;
+  byte Round;
+  byte Long;
+  unsigned int ShortSum = 0, LongSum = 0;
+  int ShortCount = 0, LongCount = 0;
+
+  PulseMap_mid = -1; // new frame
+  RawFeatures.Number = RawSignal.Number;
+  RawFeatures.Min = 0xFF;
+  RawFeatures.Max = 0;
+  RawFeatures.Gap = 0;
+  for (x = 0; x < PULSE_HISTOGRAM_BINS; x++)
+    RawFeatures.Histogram[x] = 0;
+
+  for (x = 2; x < RawSignal.Number; x++)
+  {
+    Pulse = RawSignal.Pulses[x];
+    if (Pulse < RawFeatures.Min)
+      RawFeatures.Min = Pulse;
+    if (Pulse > RawFeatures.Max)
+    {
+      RawFeatures.Max = Pulse;
+      RawFeatures.Gap = x;
+    }
+    Pulse >>= PULSE_HISTOGRAM_SHIFT;
+    if (Pulse >= PULSE_HISTOGRAM_BINS)
+      Pulse = PULSE_HISTOGRAM_BINS - 1;
+    if (RawFeatures.Histogram[Pulse] < 0xFF)
+      RawFeatures.Histogram[Pulse]++;
+  }
+
+  if (RawFeatures.Gap == 0)
+  { // less than 3 pulses, nothing to measure
+    RawFeatures.Min = RawFeatures.Max = RawFeatures.Short = RawFeatures.Long = RawFeatures.Ratio = RawFeatures.Unit = 0;
+    return;
+  }
+
+  // ==========================================================================
+  // Clock recovery. Data pulses fall in two clusters, T and Ratio * T (1:2 for Manchester,
+  // 1:3 for most PWM remotes). Two-means: split halfway between the shortest and the longest
+  // data pulse, then move the split halfway between both cluster means until it settles.
+  // ==========================================================================
+  // The shortest data pulses are taken from the first histogram bin holding a few pulses, so that
+  // a single glitch does not move the range of data pulses.
+  for (x = 0; (x < PULSE_HISTOGRAM_BINS - 1) && (RawFeatures.Histogram[x] < 2 + RawSignal.Number / 32); x++)
+    ;
+  Min = (x << PULSE_HISTOGRAM_SHIFT) + (1 << (PULSE_HISTOGRAM_SHIFT - 1)); // bin centre
+  Low = Min / 2;
+  Limit = ((x + 1) * PULSE_UNIT_RANGE > (0xFF >> PULSE_HISTOGRAM_SHIFT)) ? 0xFF : ((x + 1) << PULSE_HISTOGRAM_SHIFT) * PULSE_UNIT_RANGE; // from the bin's upper edge
+  Mid = (Min + ((RawFeatures.Max < Limit) ? RawFeatures.Max : Limit)) / 2;
+  for (Round = 0; Round < 4; Round++)
+  {
+    ShortSum = LongSum = 0;
+    ShortCount = LongCount = 0;
+    for (x = 2; x < RawSignal.Number; x++)
+    {
+      Pulse = RawSignal.Pulses[x];
+      if ((Pulse > Limit) || (Pulse < Low))
+        continue; // gap, preamble or glitch
+      Long = (Pulse > Mid);
+      ShortSum += Pulse;
+      ShortCount++;
+      LongSum += Long ? Pulse : 0;
+      LongCount += Long;
+    }
+    ShortSum -= LongSum;
+    ShortCount -= LongCount;
+    if ((ShortCount == 0) || (LongCount == 0))
+      break; // one cluster only
+    Split = (ShortSum / ShortCount + LongSum / LongCount) / 2;
+    if (Split + 1 >= Mid && Split <= Mid + 1)
+      break; // moved a sample at most, the clusters will not change much more
+    Mid = Split;
+  }
+  if (ShortCount == 0)
+  { // all data pulses on the long side, take them as the short ones
+    ShortSum = LongSum;
+    ShortCount = LongCount;
+    LongSum = LongCount = 0;
+  }
+  if (ShortCount == 0)
+  { // no data pulses at all
+    RawFeatures.Short = RawFeatures.Long = RawFeatures.Ratio = RawFeatures.Unit = 0;
+    return;
+  }
+  RawFeatures.Short = ShortSum / ShortCount; // at least Low, never 0
+  RawFeatures.Long = (LongCount > 0) ? (LongSum / LongCount) : RawFeatures.Short;
+  RawFeatures.Ratio = (RawFeatures.Long + RawFeatures.Short / 2) / RawFeatures.Short;
+  // Least squares fit of T over both clusters: marks and spaces are stretched in opposite
+  // directions by the receiver, so using all pulses cancels most of that skew.
+  x = ShortCount + RawFeatures.Ratio * LongCount;
+  RawFeatures.Unit = ((unsigned long)ShortSum + LongSum + x / 2) / x;
+}
+
+/*********************************************************************************************\
+ * Short/long map of RawSignal at threshold Mid, one bit per pulse, kept until the next frame
+ * so that plugins using the same threshold share it (a plugin that rewrites Pulses[] has to
+ * change Number, as Plugin_001 does, so that PulseFeaturesCompute runs again). Four pulses
+ * are compared at once in a 32 bit word (sixteen with SSE2 in the host simulation).
+ \*********************************************************************************************/
+#if defined(RF_HOST_SIM) && defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+const uint32_t *PulseQuantize(byte Mid)
+{
+  int x = 0;
+  int Last = RawSignal.Number;
+  uint32_t Word = 0;
+
+  if (PulseMap_mid == Mid)
+    return PulseMap;
+
+  for (x = 0; x <= PULSE_MAP_WORDS; x++)
+    PulseMap[x] = 0;
+  PulseMap_mid = Mid;
+  if ((Last < 0) || (Last > RAW_BUFFER_SIZE) || (Mid == 0xFF))
+    return PulseMap; // no pulse is longer
+
+  x = 0;
+#if defined(RF_HOST_SIM) && defined(__SSE2__)
+  const __m128i Above = _mm_set1_epi8((char)(Mid + 1));
+  for (; x + 15 <= Last; x += 16)
+  { // Pulse > Mid  <=>  max(Pulse, Mid + 1) == Pulse
+    __m128i v = _mm_loadu_si128((const __m128i *)(RawSignal.Pulses + x));
+    unsigned int m = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(v, Above), v)); // pulse x in bit 0
+    m = ((m >> 1) & 0x5555) | ((m & 0x5555) << 1);
+    m = ((m >> 2) & 0x3333) | ((m & 0x3333) << 2);
+    m = ((m >> 4) & 0x0F0F) | ((m & 0x0F0F) << 4);
+    m = ((m >> 8) & 0x00FF) | ((m & 0x00FF) << 8); // pulse x in bit 15
+    PulseMap[x >> 5] |= (uint32_t)m << (16 - (x & 16));
+  }
+#endif
+#if (defined(ESP32) || defined(ESP8266) || defined(RF_HOST_SIM))
+  // Per byte, Pulse > Mid is bit 7 of (Pulse | (Pulse & 0x7F) + 127 - Mid) when Mid < 128,
+  // or of (Pulse & (Pulse & 0x7F) + 255 - Mid) otherwise. No carry crosses a byte.
+  // Little endian: pulse x is the lowest byte. Not on AVR, where 32 bit multiplies are slow.
+  const uint32_t Add = (uint32_t)((Mid < 128) ? (127 - Mid) : (255 - Mid)) * 0x01010101;
+  uint32_t Four;
+  uint32_t Sum;
+  for (; x + 3 <= Last; x += 4)
+  {
+    memcpy(&Four, RawSignal.Pulses + x, 4);
+    Sum = (Four & 0x7F7F7F7F) + Add;
+    Sum = ((Mid < 128) ? (Four | Sum) : (Four & Sum)) & 0x80808080;
+    Sum = (((Sum >> 7) * 0x08040201) >> 24) & 0x0F; // gather the four bits, pulse x highest
+    PulseMap[x >> 5] |= Sum << (28 - (x & 31));
+  }
+#endif
+  for (; x <= Last; x++)
+  {
+    Word = (RawSignal.Pulses[x] > Mid);
+    PulseMap[x >> 5] |= Word << (31 - (x & 31));
+  }
+  return PulseMap;
+}
+
+/*********************************************************************************************\
+ * Count bits (up to 32) from Map, one every Step pulses starting at pulse First, MSB first.
+ * Step 1 and 2 only take shifts and masks, 32 pulses at a time.
+ \*********************************************************************************************/
+static inline uint32_t PulseMapWindow(const uint32_t *Map, int First)
+{ // 32 pulses starting at First
+  int w = First >> 5;
+  int o = First & 31;
+  return o ? ((Map[w] << o) | (Map[w + 1] >> (32 - o))) : Map[w];
+}
+
+static inline uint32_t PulseMapEven(uint32_t Window)
+{ // pulses First, First + 2, ... of a window, as 16 bits
+  uint32_t v = (Window >> 1) & 0x55555555;
+  v = (v | (v >> 1)) & 0x33333333;
+  v = (v | (v >> 2)) & 0x0F0F0F0F;
+  v = (v | (v >> 4)) & 0x00FF00FF;
+  return (v | (v >> 8)) & 0x0000FFFF;
+}
+
+unsigned long PulseMapBits(const uint32_t *Map, int First, byte Count, byte Step)
+{
+  uint32_t Bits = 0;
+
+  if ((Count == 0) || (Count > 32) || (First + (Count - 1) * Step > RAW_BUFFER_SIZE))
+    return 0;
+
+  if (Step == 1)
+    return PulseMapWindow(Map, First) >> (32 - Count);
+
+  if (Step == 2)
+  {
+    Bits = PulseMapEven(PulseMapWindow(Map, First));
+    if (Count <= 16)
+      return Bits >> (16 - Count);
+    Bits = (Bits << 16) | PulseMapEven(PulseMapWindow(Map, First + 32));
+    return Bits >> (32 - Count);
+  }
+
+  for (byte i = 0; i < Count; i++, First += Step)
+    Bits = (Bits << 1) | PULSE_MAP_BIT(Map, First);
+  return Bits;
+}
+
 /*********************************************************************************************/
 /*
   // RFLink Board specific: Generate a short pulse to switch the Aurel Transceiver from TX to RX mode.
@@ -22,15 +22,118 @@ struct RawSignalStruct // Raw signal variabelen places in a struct
   // First pulse is located in element 1. Element 0 is used for special purposes, like signalling the use of a specific plugin
 };
 
-extern RawSignalStruct RawSignal;
-extern unsigned long SignalCRC;   // holds the bitstream value for some plugins to identify RF repeats
-extern unsigned long SignalCRC_1; // holds the previous SignalCRC (for mixed burst protocols)
+extern RawSignalStruct RawSignalPool[RAW_SIGNAL_POOL];
+extern RawSignalStruct *RawSignalDecode;  // frame being decoded
+extern RawSignalStruct *RawSignalCapture; // frame being captured
+#define RawSignal (*RawSignalDecode)      // plugins always work on the frame being decoded
 extern byte SignalHash;           // holds the processed plugin number
-extern byte SignalHashPrevious;   // holds the last processed plugin number
-extern unsigned long RepeatingTimer;
 
+#define PULSE_HISTOGRAM_SHIFT 3 // histogram bins are 8 samples (256 uSec) wide
+#define PULSE_HISTOGRAM_BINS 16 // last bin also holds all longer pulses
+#define PULSE_UNIT_RANGE 6      // pulses longer than 6x the shortest ones are gaps or preambles, not data
+
+struct PulseFeaturesStruct // Pulse features of RawSignal, in samples like Pulses[]
+{
+  int Number;                           // RawSignal.Number these features belong to
+  byte Min;                             // shortest pulse
+  byte Max;                             // longest pulse
+  int Gap;                              // position of the longest pulse (gap or preamble)
+  byte Short;                           // mean of the short data pulses
+  byte Long;                            // mean of the long data pulses
+  byte Ratio;                           // Long / Short rounded, 1 when all data pulses are alike
+  byte Unit;                            // recovered base time unit T: Short ~ T, Long ~ Ratio * T
+  byte Histogram[PULSE_HISTOGRAM_BINS]; // pulse count per bin
+};
+extern PulseFeaturesStruct RawFeatures;
+
+// ***********************************************************************************
+// Pulse length thresholds, uSec to samples at compile time, so that plugins compare bytes.
+// Plugins always see frames at RAWSIGNAL_SAMPLE_RATE (see RawSignalRescale), then:
+//   Pulses[x] > PULSE_FLOOR(us)  <=>  Pulses[x] * RAWSIGNAL_SAMPLE_RATE > us  (same for <=)
+//   Pulses[x] < PULSE_CEIL(us)   <=>  Pulses[x] * RAWSIGNAL_SAMPLE_RATE < us  (same for >=)
+// ***********************************************************************************
+constexpr int PULSE_FLOOR(unsigned long us) { return us / RAWSIGNAL_SAMPLE_RATE; }
+constexpr int PULSE_CEIL(unsigned long us) { return (us + RAWSIGNAL_SAMPLE_RATE - 1) / RAWSIGNAL_SAMPLE_RATE; }
+
+// Threshold relative to the clock recovered from the current frame: Eighths/8 of RawFeatures.Unit,
+// in samples. PulseUnits(16) splits T from 3T whatever the transmitter's actual T is.
+inline byte PulseUnits(byte Eighths)
+{
+  unsigned int Samples = (RawFeatures.Unit * Eighths + 4) >> 3;
+  return (Samples > 0xFF) ? 0xFF : Samples;
+}
+
+// ***********************************************************************************
+// Short/long pulse map: one bit per pulse, set when the pulse is longer than a threshold.
+// Pulse x is bit (31 - (x & 31)) of word (x >> 5), so that bitstreams come out MSB first.
+// ***********************************************************************************
+#define PULSE_MAP_WORDS ((RAW_BUFFER_SIZE + 32) / 32) // Pulses[0..RAW_BUFFER_SIZE]
+#define PULSE_MAP_BIT(Map, x) (((Map)[(x) >> 5] >> (31 - ((x)&31))) & 1)
+
+// ***********************************************************************************
+// Repeat suppression: the last REPEAT_CACHE_SIZE packets decoded, keyed by plugin id and
+// decoded bits, so that repeats are caught even when other transmitters talk in between.
+// SignalRepeat(Key, Hold_ms): true when the running plugin saw Key less than Hold_ms ago,
+//   the entry is refreshed so that a held button stays suppressed. Else Key is stored.
+// SignalSeen(Id, Within_ms): true when plugin Id accepted any packet less than Within_ms ago,
+//   as recorded by PluginRXCall() through SignalDecoded(), for all plugins.
+// Times are RawSignal.Time, compared as differences so that millis() may wrap.
+// ***********************************************************************************
+boolean SignalRepeat(unsigned long Key, unsigned int Hold_ms);
+boolean SignalSeen(byte Id, unsigned int Within_ms);
+void SignalDecoded(byte Id);
+#ifdef SIGNAL_MEMO
+unsigned long PulseFingerprint(void);
+boolean SignalMemoCheck(unsigned long Fingerprint);
+void SignalMemoStore(unsigned long Fingerprint);
+#endif
+
+void InitFrames(void);
+void RawSignalRescale(void);
+void PulseFeaturesCompute(void);
+const uint32_t *PulseQuantize(byte Mid);
+unsigned long PulseMapBits(const uint32_t *Map, int First, byte Count, byte Step);
 boolean FetchSignal();
 boolean ScanEvent(void);
+#ifdef SIGNAL_COMBINE
+boolean SignalCombine(void);
+#endif
+
+#if defined(RF_ISR_CAPTURE) && (defined(ESP32) || defined(ESP8266) || defined(RF_HOST_SIM))
+extern volatile unsigned int EdgeHead;     // next free slot, written by RF_ISR() only
+extern volatile unsigned int EdgeTail;     // next edge to assemble, written by FetchSignal() only
+extern volatile unsigned long EdgeOverflow; // edges dropped because the ring was full
+
+boolean PushEdge(unsigned long Edge); // Edge = micros() timestamp, bit 0 = RX level after the edge
+void setup_RF_ISR();
+#endif
+
+// ***********************************************************************************
+// Capture hardware abstraction: FetchSignal() only sees the RX pin and the clocks
+// through these, so the same capture code runs on target and in host simulation.
+// ***********************************************************************************
+#ifdef RF_HOST_SIM
+byte Sim_RxLevel(void);
+unsigned long Sim_Micros(void);
+unsigned long Sim_Millis(void);
+void Sim_Delay(unsigned long);
+unsigned long Sim_Cycles(void);
+#define RF_RX_LEVEL() Sim_RxLevel()
+#define RF_MICROS() Sim_Micros()
+#define RF_MILLIS() Sim_Millis()
+#define RF_DELAY(ms) Sim_Delay(ms)
+#define RF_CYCLES() Sim_Cycles()
+#else
+#define RF_RX_LEVEL() digitalRead(PIN_RF_RX_DATA)
+#define RF_MICROS() micros()
+#define RF_MILLIS() millis()
+#define RF_DELAY(ms) delay(ms)
+#if (defined(ESP32) || defined(ESP8266))
+#define RF_CYCLES() ESP.getCycleCount()
+#else
+#define RF_CYCLES() micros() // no cycle counter on AVR, uSec are the closest
+#endif
+#endif
 // void RFLinkHW(void);
 // void RawSendRF(void);
 
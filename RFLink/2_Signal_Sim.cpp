@@ -0,0 +1,100 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifdef RF_HOST_SIM
+// ***********************************************************************************
+// Host (Linux) backend of the capture hardware abstraction.
+// The RX pin level is replayed from a recorded edge timeline and time is a virtual
+// clock, so FetchSignal() runs unchanged, deterministic and at full host speed.
+// Host build provides its own Arduino.h (byte, boolean, Serial...), no pin is touched.
+// ***********************************************************************************
+#include <Arduino.h>
+#include <time.h>
+#include "2_Signal.h"
+#include "2_Signal_Sim.h"
+
+unsigned long SimClock_us = 0;  // virtual clock
+unsigned long SimStep_us = 1;   // virtual time spent by each pin or clock read (target polling cost)
+unsigned long SimPolls = 0;     // number of pin or clock reads done by the capture code
+unsigned long SimFrames = 0;    // number of frames handed over by FetchSignal()
+
+const unsigned long *SimEdges; // edge timestamps in uSec, ascending
+unsigned int SimEdgeCount = 0;
+unsigned int SimEdgeIndex = 0; // next edge to happen
+byte SimLevel = LOW;           // RX level before next edge
+
+void Sim_Load(const unsigned long *Edges, unsigned int Count, byte StartLevel)
+{
+  SimEdges = Edges;
+  SimEdgeCount = Count;
+  SimEdgeIndex = 0;
+  SimLevel = StartLevel;
+  SimClock_us = 0;
+  SimPolls = 0;
+  SimFrames = 0;
+#ifdef RF_ISR_CAPTURE
+  EdgeHead = EdgeTail = 0;
+  EdgeOverflow = 0;
+#endif
+}
+
+boolean Sim_Done(void)
+{
+  return (SimEdgeIndex >= SimEdgeCount);
+}
+
+// Move the virtual clock, playing all edges that happened meanwhile
+void Sim_Advance(unsigned long Duration_us)
+{
+  SimClock_us += Duration_us;
+  while ((SimEdgeIndex < SimEdgeCount) && (SimEdges[SimEdgeIndex] <= SimClock_us))
+  {
+    SimLevel = !SimLevel;
+#ifdef RF_ISR_CAPTURE
+    PushEdge((SimEdges[SimEdgeIndex] & ~1UL) | SimLevel); // what RF_ISR() would have done
+#endif
+    SimEdgeIndex++;
+  }
+}
+
+byte Sim_RxLevel(void)
+{
+  SimPolls++;
+  Sim_Advance(SimStep_us);
+  return SimLevel;
+}
+
+unsigned long Sim_Micros(void)
+{
+  SimPolls++;
+  Sim_Advance(SimStep_us);
+  return SimClock_us;
+}
+
+unsigned long Sim_Millis(void)
+{
+  SimPolls++;
+  Sim_Advance(SimStep_us);
+  return SimClock_us / 1000UL;
+}
+
+void Sim_Delay(unsigned long Duration_ms)
+{
+  Sim_Advance(Duration_ms * 1000UL);
+}
+
+// Virtual ESP8266 cycle counter (80 MHz) running on host time, as the virtual clock
+// does not move while plugins decode. Not counted as a poll.
+unsigned long Sim_Cycles(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (unsigned long)now.tv_sec * 80000000UL + (unsigned long)now.tv_nsec * 2UL / 25UL;
+}
+
+#endif // RF_HOST_SIM
@@ -0,0 +1,27 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef Signal_Sim_h
+#define Signal_Sim_h
+
+#ifdef RF_HOST_SIM
+#include <Arduino.h>
+
+extern unsigned long SimClock_us; // virtual clock
+extern unsigned long SimStep_us;  // virtual time spent by each pin or clock read (target polling cost)
+extern unsigned long SimPolls;    // number of pin or clock reads done by the capture code
+extern unsigned long SimFrames;   // number of frames handed over by FetchSignal()
+extern unsigned int SimEdgeIndex; // edges played so far
+
+// Replay Edges[] (uSec timestamps, ascending) on the RX pin, starting at StartLevel
+void Sim_Load(const unsigned long *Edges, unsigned int Count, byte StartLevel);
+boolean Sim_Done(void);
+void Sim_Advance(unsigned long Duration_us);
+
+#endif // RF_HOST_SIM
+
+#endif // Signal_Sim_h
@@ -6,120 +6,265 @@
 // ************************************* //
 
 #include <Arduino.h>
-// #include "3_Serial.h"
+#include "RFLink.h"
+#include "2_Signal.h"
+#include "3_Serial.h"
+#include "4_Display.h"
+#include "5_Plugin.h"
+#include "5_Plugin_Flex.h"
 
-//char InputBuffer_Serial[INPUT_COMMAND_SIZE];
+char InputBuffer_Serial[INPUT_COMMAND_SIZE];
+
+#ifdef SERIAL_BINARY
+boolean SerialBinary = false;
+
+const char *SerialNames[SERIAL_BINARY_NAMES]; // PROGMEM names, by code
+byte SerialNameNext = 0;                      // code given to the next new name
+
+static void SerialNamesClear(void)
+{
+  for (byte x = 0; x < SERIAL_BINARY_NAMES; x++)
+    SerialNames[x] = NULL;
+  SerialNameNext = 0;
+}
+#endif
 
 /*********************************************************************************************/
-/*
+// Collect serial characters without blocking RF reception, true when a command answer is in Event
 boolean CheckSerial()
 {
-  static byte SerialInByte = 0;                                               // incoming character value
-  static int SerialInByteCounter = 0;                                         // number of bytes counter
-  static byte ValidCommand = 0;
-  static unsigned long FocusTimer;                                            // Timer to keep focus on the task during communication
-
-  InputBuffer_Serial[0] = 0;                                                  // erase serial buffer string
-
-  // SERIAL: *************** Check if there is data ready on the serial port **********************
-  if (Serial.available()) {
-    FocusTimer = millis() + FOCUS_TIME_MS;
-
-    while (millis() < FocusTimer) {                                           // standby
-      if (Serial.available()) {
-        SerialInByte = Serial.read();
-
-        if (isprint(SerialInByte))
-          if (SerialInByteCounter < (INPUT_COMMAND_SIZE - 1))
-            InputBuffer_Serial[SerialInByteCounter++] = SerialInByte;
-
-        if (SerialInByte == '\n') {                                           // new line character
-          InputBuffer_Serial[SerialInByteCounter] = 0;                        // serieel data is complete
-          //Serial.print("20;incoming;");
-          //Serial.println(InputBuffer_Serial);
-          if (strlen(InputBuffer_Serial) > 7) {                               // need to see minimal 8 characters on the serial port
-            // 10;....;..;ON;
-            if (strncmp (InputBuffer_Serial, "10;", 3) == 0) {               // Command from Master to RFLink
-              // -------------------------------------------------------
-              // Handle Device Management Commands
-              // -------------------------------------------------------
-              if (strcasecmp(InputBuffer_Serial + 3, "PING;") == 0) {
-                sprintf_P(InputBuffer_Serial, PSTR("20;%02X;PONG;"), PKSequenceNumber++);
-                Serial.println(InputBuffer_Serial);
-              } else if (strcasecmp(InputBuffer_Serial + 3, "REBOOT;") == 0) {
-                strcpy(InputBuffer_Serial, "reboot");
-                // Reboot();
-              } else if (strncasecmp(InputBuffer_Serial + 3, "RFDEBUG=O", 9) == 0) {
-                if (InputBuffer_Serial[12] == 'N' || InputBuffer_Serial[12] == 'n' ) {
-                  RFDebug = true;                                        // full debug on
-                  RFUDebug = false;                                      // undecoded debug off
-                  QRFDebug = false;                                      // undecoded debug off
-                  sprintf_P(InputBuffer_Serial, PSTR("20;%02X;RFDEBUG=ON;"), PKSequenceNumber++);
-                } else {
-                  RFDebug = false;                                        // full debug off
-                  sprintf_P(InputBuffer_Serial, PSTR("20;%02X;RFDEBUG=OFF;"), PKSequenceNumber++);
-                }
-                Serial.println(InputBuffer_Serial);
-              } else if (strncasecmp(InputBuffer_Serial + 3, "RFUDEBUG=O", 10) == 0) {
-                if (InputBuffer_Serial[13] == 'N' || InputBuffer_Serial[13] == 'n') {
-                  RFUDebug = true;                                       // undecoded debug on
-                  QRFDebug = false;                                      // undecoded debug off
-                  RFDebug = false;                                       // full debug off
-                  sprintf_P(InputBuffer_Serial, PSTR("20;%02X;RFUDEBUG=ON;"), PKSequenceNumber++);
-                } else {
-                  RFUDebug = false;                                       // undecoded debug off
-                  sprintf_P(InputBuffer_Serial, PSTR("20;%02X;RFUDEBUG=OFF;"), PKSequenceNumber++);
-                }
-                Serial.println(InputBuffer_Serial);
-              } else if (strncasecmp(InputBuffer_Serial + 3, "QRFDEBUG=O", 10) == 0) {
-                if (InputBuffer_Serial[13] == 'N' || InputBuffer_Serial[13] == 'n') {
-                  QRFDebug = true;                                       // undecoded debug on
-                  RFUDebug = false;                                      // undecoded debug off
-                  RFDebug = false;                                       // full debug off
-                  sprintf_P(InputBuffer_Serial, PSTR("20;%02X;QRFDEBUG=ON;"), PKSequenceNumber++);
-                } else {
-                  QRFDebug = false;                                      // undecoded debug off
-                  sprintf_P(InputBuffer_Serial, PSTR("20;%02X;QRFDEBUG=OFF;"), PKSequenceNumber++);
-                }
-                Serial.println(InputBuffer_Serial);
-              } else if (strncasecmp(InputBuffer_Serial + 3, "VERSION", 7) == 0) {
-                sprintf_P(InputBuffer_Serial, PSTR("20;%02X;VER=1.1;REV=%02x;BUILD=%02x;"), PKSequenceNumber++, REVNR, BUILDNR);
-                Serial.println(InputBuffer_Serial);
-              } else {
-                // -------------------------------------------------------
-                // Handle Generic Commands / Translate protocol data into Nodo text commands
-                // -------------------------------------------------------
-                // check plugins
-                if (InputBuffer_Serial[SerialInByteCounter - 1] == ';') InputBuffer_Serial[SerialInByteCounter - 1] = 0; // remove last ";" char
-                if (PluginTXCall(0, InputBuffer_Serial)) {
-                  ValidCommand = 1;
-                } else {
-                  // Answer that an invalid command was received?
-                  ValidCommand = 2;
-                }
-              }
-            }
-          } // if > 7
-          if (ValidCommand != 0) {
-            if (ValidCommand == 1) {
-              sprintf_P(InputBuffer_Serial, PSTR("20;%02X;OK;"), PKSequenceNumber++);
-              Serial.println( InputBuffer_Serial );
-            } else {
-              sprintf_P(InputBuffer_Serial, PSTR("20;%02X;CMD UNKNOWN;"), PKSequenceNumber++); // Node and packet number
-              Serial.println( InputBuffer_Serial );
-            }
-          }
-          SerialInByteCounter = 0;
-          InputBuffer_Serial[0] = 0;                                          // serial data has been processed.
-          ValidCommand = 0;
-          FocusTimer = millis() + FOCUS_TIME_MS;
-        }// if(SerialInByte
-      }// if(Serial.available())
-    }// while
-  }// if(Serial.available())
+  static byte SerialInByteCounter = 0; // number of bytes counter
+  byte SerialInByte;                   // incoming character value
+
+  while (Serial.available())
+  {
+    SerialInByte = Serial.read();
+
+    if (SerialInByte == '\n')
+    {                                                  // new line character
+      InputBuffer_Serial[SerialInByteCounter] = 0;     // serial data is complete
+      SerialInByteCounter = 0;
+      return ExecuteCommand(InputBuffer_Serial);
+    }
+
+    if (isprint(SerialInByte))
+      if (SerialInByteCounter < (INPUT_COMMAND_SIZE - 1))
+        InputBuffer_Serial[SerialInByteCounter++] = SerialInByte;
+  }
+  return false;
+}
 
+/*********************************************************************************************/
+// Handle a command from Master to RFLink (serial line or MQTT payload), answer in Event
+boolean ExecuteCommand(char *Command)
+{
+  byte PluginID;
+  char *Value;
+
+  if (strncmp(Command, "10;", 3) != 0)
+    return false;
+  Command += 3;
+
+  // -------------------------------------------------------
+  // Handle Device Management Commands
+  // -------------------------------------------------------
+  display_Header();
+  if (strcasecmp_P(Command, PSTR("PING;")) == 0)
+  {
+    display_Name(PSTR("PONG"));
+  }
+  else if (strncasecmp_P(Command, PSTR("VERSION"), 7) == 0)
+  {
+    display_Splash();
+  }
+  else if ((strncasecmp_P(Command, PSTR("PLUGIN"), 6) == 0) && ((Value = strchr(Command, '=')) != NULL))
+  { // 10;PLUGIN004=OFF; / 10;PLUGIN004=ON;
+    PluginID = atoi(Command + 6);
+    if (PluginSetState(PluginID, (strncasecmp_P(Value + 1, PSTR("ON"), 2) == 0) ? P_Enabled : P_Disabled))
+      display_PLUGIN(PluginID, PluginGetState(PluginID) >= P_Enabled);
+    else
+      display_Name(PSTR("CMD UNKNOWN"));
+  }
+#ifdef FLEX_DECODER
+  else if (strncasecmp_P(Command, PSTR("FLEX"), 4) == 0)
+  { // 10;FLEX1=PWM,74,750,1650,36,2,0-7,12-23; / 10;FLEX1; / 10;FLEX1=OFF;
+    if (!FlexCommand(atoi(Command + 4), strchr(Command, '=')))
+      display_Name(PSTR("CMD UNKNOWN"));
+  }
+#endif
+#ifdef SERIAL_BINARY
+  else if (strncasecmp_P(Command, PSTR("BINARY="), 7) == 0)
+  { // 10;BINARY=ON; / 10;BINARY=OFF;
+    SerialBinary = (strncasecmp_P(Command + 7, PSTR("ON"), 2) == 0);
+    SerialNamesClear(); // the host may have just started
+    if (SerialBinary)
+      display_Name(PSTR("BINARY=ON"));
+    else
+      display_Name(PSTR("BINARY=OFF"));
+  }
+#endif
+#ifdef PUBLISH_CHANGES
+  else if (strcasecmp_P(Command, PSTR("PUBLISH;")) == 0)
+  { // 10;PUBLISH;
+    display_Name(PSTR("PUBLISH"));
+    display_PUBLISH();
+  }
+#endif
+#ifdef PLUGIN_STATS
+  else if (strcasecmp_P(Command, PSTR("STATS;")) == 0)
+  { // 10;STATS; the report follows this answer, counters restart
+    display_Name(PSTR("STATS"));
+    PluginStatsRequest = true;
+  }
+#endif
+#ifdef EVENT_QUEUE
+  else if (strcasecmp_P(Command, PSTR("QUEUE;")) == 0)
+  { // 10;QUEUE;
+    display_Name(PSTR("QUEUE"));
+    display_QUEUE();
+  }
+#endif
+  else
+  {
+    display_Name(PSTR("CMD UNKNOWN"));
+  }
+  display_Footer();
   return true;
 }
-*/
 
+#ifdef SERIAL_BINARY
 /*********************************************************************************************/
+// A5 <kind> <length> <payload> <CRC-8>
+static void SerialWriteFrame(char Kind, const byte *Payload, byte Length)
+{
+  byte Header[3] = {0xA5, (byte)Kind, Length};
+  byte CRC = 0;
+
+  for (int x = 1; x < 3 + Length; x++)
+  {
+    CRC ^= (x < 3) ? Header[x] : Payload[x - 3];
+    for (byte b = 0; b < 8; b++)
+      CRC = (CRC & 0x80) ? (CRC << 1) ^ 0x07 : (CRC << 1);
+  }
+  Serial.write(Header, sizeof(Header));
+  Serial.write(Payload, Length);
+  Serial.write(CRC);
+}
+
+// Code of a name, with an 'N' frame first when the host does not know it
+static byte SerialNameCode(const char *Name)
+{
+  byte Frame[33];
+  byte Length = 0;
+  byte Code;
+  char c;
+
+  for (Code = 0; Code < SERIAL_BINARY_NAMES; Code++)
+    if (SerialNames[Code] == Name)
+      return Code;
+
+  Code = SerialNameNext;
+  SerialNameNext = (SerialNameNext + 1) % SERIAL_BINARY_NAMES;
+  SerialNames[Code] = Name;
+  Frame[Length++] = Code;
+  while ((c = pgm_read_byte(Name++)) && (Length < sizeof(Frame)))
+    Frame[Length++] = c;
+  SerialWriteFrame('N', Frame, Length);
+  return Code;
+}
+
+// Event as an 'E' frame, the fields that do not fit in SERIAL_FRAME_SIZE are left out and
+// the event marked Truncated, as in text
+void SerialWriteEvent(void)
+{
+  byte Frame[SERIAL_FRAME_SIZE];
+  byte Length = 0;
+
+  Frame[Length++] = Event.Sequence;
+  Frame[Length++] = Event.Protocol;
+  Frame[Length++] = (Event.Name != NULL) ? SerialNameCode(Event.Name) : 0xFF;
+
+  for (byte x = 0; x < Event.Fields; x++)
+  {
+    const EventFieldStruct *Field = &Event.Field[x];
+    const char *Text = EventFieldText(Field);
+    unsigned long Value = Field->Value;
+    byte Size = 0;
+
+    if (Text != NULL)
+    {
+      Size = strlen(Text);
+      if (Length + 3 + Size > SERIAL_FRAME_SIZE - 4)
+      {
+        EventTruncate();
+        break;
+      }
+      Frame[Length++] = Field->Type;
+      Frame[Length++] = Size;
+      Frame[Length++] = Value & 0xFF;
+      memcpy(Frame + Length, Text, Size);
+      Length += Size;
+    }
+    else
+    {
+      while ((Size < 4) && (Value >> (8 * Size)))
+        Size++;
+      if (Length + 2 + Size > SERIAL_FRAME_SIZE - 4)
+      {
+        EventTruncate();
+        break;
+      }
+      Frame[Length++] = Field->Type;
+      Frame[Length++] = (Field->Digits << 4) | Size;
+      for (; Size; Size--, Value >>= 8)
+        Frame[Length++] = Value & 0xFF;
+    }
+  }
+  SerialWriteFrame('E', Frame, Length);
+}
+#endif
+
+/*********************************************************************************************/
+// Debug dump of RawSignal: 20;XX;DEBUG;Pulses=<number>;Pulses(uSec)=<pulses>; or 'P' frames
+void SerialPulses(void)
+{
+  int i;
+
+#ifdef SERIAL_BINARY
+  if (SerialBinary)
+  {
+    for (i = 1; i < RawSignal.Number + 1; i += SERIAL_PULSES_FRAME)
+    {
+      byte Frame[SERIAL_PULSES_FRAME + 6];
+      byte Length = 0;
+
+      Frame[Length++] = QRFDebug;
+      Frame[Length++] = RAWSIGNAL_SAMPLE_RATE;
+      Frame[Length++] = RawSignal.Number & 0xFF;
+      Frame[Length++] = RawSignal.Number >> 8;
+      Frame[Length++] = i & 0xFF;
+      Frame[Length++] = i >> 8;
+      for (int x = i; (x < RawSignal.Number + 1) && (x < i + SERIAL_PULSES_FRAME); x++)
+        Frame[Length++] = RawSignal.Pulses[x];
+      SerialWriteFrame('P', Frame, Length);
+    }
+    return;
+  }
+#endif
+  Serial.print(F("20;XX;DEBUG;Pulses=")); // debug data
+  Serial.print(RawSignal.Number);         // print number of pulses
+  Serial.print(F(";Pulses(uSec)="));      // print pulse durations
+  // ----------------------------------
+  for (i = 1; i < RawSignal.Number + 1; i++)
+  {
+    if (QRFDebug == true)
+      Serial.printf("%02x", RawSignal.Pulses[i]);
+    else
+    {
+      Serial.print(RawSignal.Pulses[i] * RAWSIGNAL_SAMPLE_RATE);
+      if (i < RawSignal.Number)
+        Serial.write(',');
+    }
+  }
+  Serial.print(F(";\r\n"));
+}
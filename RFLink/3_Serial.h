@@ -11,7 +11,32 @@
 #include <Arduino.h>
 #include "RFLink.h"
 
-//extern char InputBuffer_Serial[INPUT_COMMAND_SIZE];   // Buffer for Seriel data
-// boolean CheckSerial();
+extern char InputBuffer_Serial[INPUT_COMMAND_SIZE]; // Buffer for Serial data
+
+boolean CheckSerial();
+boolean ExecuteCommand(char *Command);
+void SerialPulses(void); // debug dump of RawSignal by Plugin_001 / Plugin_254
+
+#ifdef SERIAL_BINARY
+// ***********************************************************************************
+// Binary framing on Serial, about half the bytes of the text lines. Turned on with
+// 10;BINARY=ON; and off with 10;BINARY=OFF;, tools/rflink_text turns it back into text.
+//
+// Frame: A5 <kind> <length> <length bytes> <CRC-8, polynomial 07, of kind, length and the bytes>
+//   <kind> is a capital letter, decoders skip the kinds they do not know
+//   'N' name:   <code> <name>, sent before the first event that uses the code
+//   'E' event:  <sequence> <Plugin_id, 0 for answers> <name code, FF: none> then for each field
+//               <EVENT_Type> <digits << 4 | value bytes> <value, LSB first>, or for the text fields
+//               (IDc, SWITCHc, FLEXDEF) <EVENT_Type> <text length> <low byte of value> <text>
+//   'P' pulses: <flags, 1: QRFDebug> <uSec per sample> <number:2> <first:2> <RawSignal.Pulses[first..]>,
+//               2-byte values LSB first, long frames are sent in several 'P' frames
+// ***********************************************************************************
+#define SERIAL_BINARY_NAMES 16  // name codes the host keeps, reused round robin
+#define SERIAL_FRAME_SIZE 160   // longest frame
+#define SERIAL_PULSES_FRAME 128 // samples per 'P' frame
+
+extern boolean SerialBinary;
+void SerialWriteEvent(void);
+#endif
 
 #endif
\ No newline at end of file
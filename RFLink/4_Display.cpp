@@ -9,9 +9,489 @@
 #include "4_Display.h"
 
 byte PKSequenceNumber = 0;       // 1 byte packet counter
-char dbuffer[30];                // Buffer for message chunk data
 char pbuffer[PRINT_BUFFER_SIZE]; // Buffer for complete message data
 
+// --------------------------------------------------------------------------------- //
+// Message builder: fields are appended at a cursor instead of formatting them apart //
+// and strcat()ing them, which scanned pbuffer again for each one. The last bytes    //
+// are kept for the footer, so that a message too long for pbuffer is cut short but  //
+// still ends its line. Printing starts again once pbuffer[0] is set to 0.           //
+// --------------------------------------------------------------------------------- //
+#define PRINT_FOOTER_SIZE 3 // ";\r\n"
+
+unsigned int PrintLength = 0; // strlen(PrintBuffer), as long as PrintBuffer[0] is not 0
+static char *PrintBuffer = pbuffer;
+static unsigned int PrintSize = PRINT_BUFFER_SIZE;
+
+// End of PrintBuffer, where the next field goes
+static inline char *print_Cursor(void)
+{
+  if (PrintBuffer[0] == 0)
+    PrintLength = 0; // emptied since the last field
+  return PrintBuffer + PrintLength;
+}
+
+// Room left for a field, the footer can also use the bytes kept for it
+static inline unsigned int print_Room(boolean Footer)
+{
+  unsigned int End = PrintSize - 1 - (Footer ? 0 : PRINT_FOOTER_SIZE);
+
+  print_Cursor();
+  return (PrintLength < End) ? End - PrintLength : 0;
+}
+
+static void print_Text(const char *Text)
+{
+  unsigned int Room = print_Room(false);
+  char *Cursor = PrintBuffer + PrintLength;
+
+  while (*Text && Room--)
+    *Cursor++ = *Text++;
+  *Cursor = 0;
+  PrintLength = Cursor - PrintBuffer;
+}
+
+static void print_Text_P(const char *Text, boolean Footer = false)
+{
+  unsigned int Room = print_Room(Footer);
+  char *Cursor = PrintBuffer + PrintLength;
+  char c;
+
+  while ((c = pgm_read_byte(Text++)) && Room--)
+    *Cursor++ = c;
+  *Cursor = 0;
+  PrintLength = Cursor - PrintBuffer;
+}
+
+// As "%0<Width>lx" (or "%0<Width>lX"), digits are written backwards then copied like text
+static void print_Hex(unsigned long Value, byte Width, boolean Upper = false)
+{
+  char Digits[3 * sizeof(Value) + 1]; // Width is at most 8
+  char *Last = Digits + sizeof(Digits) - 1;
+  char *First = Last;
+  const char A = (Upper ? 'A' : 'a') - 10;
+
+  *Last = 0;
+  do
+  {
+    byte Nibble = Value & 0xF;
+    *--First = (Nibble < 10) ? ('0' + Nibble) : (A + Nibble);
+    Value >>= 4;
+  } while (Value || (Last - First < Width));
+  print_Text(First);
+}
+
+// As "%0<Width>lu"
+static void print_Dec(unsigned long Value, byte Width)
+{
+  char Digits[3 * sizeof(Value) + 1];
+  char *Last = Digits + sizeof(Digits) - 1;
+  char *First = Last;
+
+  *Last = 0;
+  do
+  {
+    *--First = '0' + (Value % 10);
+    Value /= 10;
+  } while (Value || (Last - First < Width));
+  print_Text(First);
+}
+
+static void print_Char(char c)
+{
+  if (print_Room(false))
+  {
+    PrintBuffer[PrintLength++] = c;
+    PrintBuffer[PrintLength] = 0;
+  }
+}
+
+// ----------------------------------------------------------------------------------- //
+// Event record: display_* add fields to it, EventText() / EventLines() print it. Texts //
+// (IDc, SWITCHc, FLEXDEF) are copied to Event.Text, as plugins pass their own buffers. //
+// ----------------------------------------------------------------------------------- //
+EventStruct Event;
+
+// What change-only publishing makes of a field
+enum EVENT_Kind {KIND_EXACT, KIND_TEMP, KIND_HUM, KIND_HUM_BCD, KIND_LONG, KIND_KEY, KIND_EVENT};
+// How a field is scaled in JSON, JSON_NONE when it is in the topic
+enum EVENT_Json {JSON_INT, JSON_TENTH, JSON_TEMP, JSON_DIR, JSON_BCD, JSON_TEXT, JSON_NONE};
+
+struct EventDescriptor
+{
+  char Label[11];
+  byte Format;
+  byte Kind;
+  byte Json;
+};
+
+#define EVENT_TYPE(Name, Label, Format, Kind, Json) {Label, FORMAT_##Format, KIND_##Kind, JSON_##Json},
+const EventDescriptor Event_table[EVENT_Types] PROGMEM = {EVENT_TYPES};
+#undef EVENT_TYPE
+
+unsigned long EventTruncated = 0;
+
+void EventTruncate(void)
+{
+  if (!Event.Truncated)
+    EventTruncated++;
+  Event.Truncated = true;
+}
+
+static void EventAdd(byte Type, byte Digits, unsigned long Value)
+{
+  if (Event.Fields < EVENT_FIELDS)
+  {
+    EventFieldStruct *Field = &Event.Field[Event.Fields++];
+
+    Field->Type = Type;
+    Field->Digits = Digits;
+    Field->Value = Value;
+  }
+  else
+    EventTruncate();
+}
+
+// Text fields keep the offset of their text in the upper bits of Value, Extra in the low byte
+static void EventAddText(byte Type, const char *Text, byte Extra)
+{
+  byte Offset = Event.TextLength;
+
+  if ((Offset >= EVENT_TEXT_SIZE) || (Event.Fields >= EVENT_FIELDS))
+  {
+    EventTruncate();
+    return;
+  }
+  while (*Text && (Event.TextLength < EVENT_TEXT_SIZE - 1))
+    Event.Text[Event.TextLength++] = *Text++;
+  if (*Text)
+    EventTruncate(); // cut short
+  Event.Text[Event.TextLength++] = 0;
+  EventAdd(Type, 1, ((unsigned long)Offset << 8) | Extra);
+}
+
+static void print_Value(const EventFieldStruct *Field, byte Format, unsigned long Value)
+{
+  switch (Format)
+  {
+  case FORMAT_HEX:
+    print_Hex(Value, Field->Digits);
+    break;
+  case FORMAT_DEC:
+    print_Dec(Value, Field->Digits);
+    break;
+  case FORMAT_TEXT:
+    print_Text(Event.Text + (Value >> 8));
+    break;
+  case FORMAT_ONOFF:
+    if (Value)
+      print_Text_P(PSTR("ON"));
+    else
+      print_Text_P(PSTR("OFF"));
+    break;
+  case FORMAT_OKLOW:
+    if (Value)
+      print_Text_P(PSTR("OK"));
+    else
+      print_Text_P(PSTR("LOW"));
+    break;
+  case FORMAT_VERSION:
+    print_Dec(Value >> 8, 1);
+    print_Char('.');
+    print_Dec(Value & 0xFF, 1);
+    break;
+  case FORMAT_CMD:
+    if ((Value >> 8) == CMD_All)
+      print_Text_P(PSTR("ALL"));
+    switch (Value & 0xFF)
+    {
+    case CMD_On:
+      print_Text_P(PSTR("ON"));
+      break;
+    case CMD_Off:
+      print_Text_P(PSTR("OFF"));
+      break;
+    case CMD_Bright:
+      print_Text_P(PSTR("BRIGHT"));
+      break;
+    case CMD_Dim:
+      print_Text_P(PSTR("DIM"));
+      break;
+    case CMD_Unknown:
+    default:
+      print_Text_P(PSTR("UNKNOWN"));
+    }
+    break;
+  }
+}
+
+static void print_Field(const EventFieldStruct *Field, char Separator)
+{
+  const EventDescriptor *Descriptor = &Event_table[Field->Type];
+  byte Format = pgm_read_byte(&Descriptor->Format);
+  unsigned long Value = Field->Value;
+
+  print_Char(Separator);
+  if (Format == FORMAT_VERSION)
+  {
+    print_Text_P(PSTR("RFLink_ESP"));
+    print_Char(Separator);
+  }
+  print_Text_P(Descriptor->Label);
+
+  switch (Format)
+  {
+  case FORMAT_NAME: // Flex1
+    print_Dec(Value, Field->Digits);
+    return;
+  case FORMAT_PLUGIN: // PLUGIN004=ON
+    print_Dec(Value & 0xFF, Field->Digits);
+    Value >>= 8;
+    Format = FORMAT_ONOFF;
+    break;
+  case FORMAT_FLEXDEF: // FLEX1=PWM,...
+    print_Dec(Value & 0xFF, 1);
+    Format = FORMAT_TEXT;
+    break;
+  }
+  print_Char('=');
+  print_Value(Field, Format, Value);
+}
+
+// For Serial and MQTT
+void EventText(void)
+{
+  pbuffer[0] = 0;
+  print_Text_P(PSTR("20;"));
+  print_Hex(Event.Sequence, 2, true);
+  if (Event.Name != NULL)
+  {
+    print_Char(';');
+    print_Text_P(Event.Name);
+  }
+  for (byte x = 0; x < Event.Fields; x++)
+    print_Field(&Event.Field[x], ';');
+  print_Text_P(PSTR(";\r\n"), true);
+}
+
+// For the OLED
+void EventLines(void)
+{
+  pbuffer[0] = 0;
+  if (Event.Name != NULL)
+    print_Text_P(Event.Name);
+  for (byte x = 0; x < Event.Fields; x++)
+    print_Field(&Event.Field[x], '\n');
+  print_Text_P(PSTR("\n"), true);
+}
+
+#ifdef MQTT_JSON
+// Print in another buffer than pbuffer, Length is strlen(Buffer)
+static void print_To(char *Buffer, unsigned int Size, unsigned int Length)
+{
+  PrintBuffer = Buffer;
+  PrintSize = Size;
+  PrintLength = Length;
+}
+
+// Characters printed since First: letters, digits, - and _ are kept, the others become _
+static void print_Safe(unsigned int First)
+{
+  for (char *c = PrintBuffer + First; *c; c++)
+    if (!isalnum(*c) && (*c != '-'))
+      *c = '_';
+}
+
+static void print_Lower(unsigned int First)
+{
+  for (char *c = PrintBuffer + First; *c; c++)
+    *c = tolower(*c);
+}
+
+// 123 => 12.3
+static void print_Tenth(unsigned long Value)
+{
+  print_Dec(Value / 10, 1);
+  print_Char('.');
+  print_Dec(Value % 10, 1);
+}
+
+// Prefix/<name>/<ID>[/<SWITCH>], one topic per device for MQTT
+void EventTopic(char *Topic, unsigned int Size, const char *Prefix)
+{
+  unsigned int Length = PrintLength;
+  unsigned int First;
+
+  Topic[0] = 0;
+  print_To(Topic, Size, 0);
+  print_Text(Prefix);
+  if (Event.Name != NULL)
+  {
+    print_Char('/');
+    First = PrintLength;
+    print_Text_P(Event.Name);
+    print_Safe(First);
+  }
+  for (byte x = 0; x < Event.Fields; x++)
+  {
+    const EventFieldStruct *Field = &Event.Field[x];
+    const EventDescriptor *Descriptor = &Event_table[Field->Type];
+    byte Format = pgm_read_byte(&Descriptor->Format);
+
+    if (pgm_read_byte(&Descriptor->Kind) != KIND_KEY)
+      continue;
+    print_Char('/');
+    First = PrintLength;
+    if (Format == FORMAT_NAME) // Flex1
+    {
+      print_Text_P(Descriptor->Label);
+      print_Dec(Field->Value, Field->Digits);
+    }
+    else
+      print_Value(Field, Format, Field->Value);
+    print_Safe(First);
+  }
+  print_To(pbuffer, PRINT_BUFFER_SIZE, Length);
+}
+
+// {"temp":21.0,"hum":55,"bat":"ok"}: readings and commands scaled, the fields that do not fit are left out
+void EventJSON(char *Payload, unsigned int Size)
+{
+  unsigned int Length = PrintLength;
+  unsigned int First;
+
+  Payload[0] = 0;
+  print_To(Payload, Size, 0);
+  print_Char('{');
+  for (byte x = 0; x < Event.Fields; x++)
+  {
+    const EventFieldStruct *Field = &Event.Field[x];
+    const EventDescriptor *Descriptor = &Event_table[Field->Type];
+    byte Json = pgm_read_byte(&Descriptor->Json);
+    unsigned long Value = Field->Value;
+    unsigned int Last = PrintLength;
+
+    if (Json == JSON_NONE)
+      continue;
+    if (Last > 1)
+      print_Char(',');
+    print_Char('"');
+    First = PrintLength;
+    print_Text_P(Descriptor->Label);
+    print_Lower(First);
+    print_Text_P(PSTR("\":"));
+
+    switch (Json)
+    {
+    case JSON_TEMP: // high bit is the sign
+      if (Value & 0x8000)
+      {
+        print_Char('-');
+        Value &= 0x7FFF;
+      }
+      print_Tenth(Value);
+      break;
+    case JSON_TENTH:
+      print_Tenth(Value);
+      break;
+    case JSON_DIR: // 0-15, in 22.5 degree steps
+      print_Tenth(Value * 225);
+      break;
+    case JSON_BCD:
+      print_Dec((Value >> 4) * 10 + (Value & 0xF), 1);
+      break;
+    case JSON_TEXT: // "ok", "on", "alloff"...
+      print_Char('"');
+      First = PrintLength;
+      print_Value(Field, pgm_read_byte(&Descriptor->Format), Value);
+      print_Lower(First);
+      print_Char('"');
+      break;
+    default:
+      print_Dec(Value, 1);
+    }
+
+    if (print_Room(false) == 0)
+    { // may have been cut short
+      PrintLength = Last;
+      Payload[Last] = 0;
+      break;
+    }
+  }
+  print_Text_P(PSTR("}"), true);
+  print_To(pbuffer, PRINT_BUFFER_SIZE, Length);
+}
+#endif
+
+const char *EventFieldText(const EventFieldStruct *Field)
+{
+  byte Format = pgm_read_byte(&Event_table[Field->Type].Format);
+
+  if ((Format == FORMAT_TEXT) || (Format == FORMAT_FLEXDEF))
+    return Event.Text + (Field->Value >> 8);
+  return NULL;
+}
+
+void EventClear(void)
+{
+  Event.Complete = false;
+  Event.Fields = 0;
+}
+
+#ifdef EVENT_QUEUE
+// --------------------------------------------------------------------------------- //
+// Outbound queue. The counters only grow, EventRing[Counter % EVENT_QUEUE_SIZE] is   //
+// the slot of an event, Head - Tail[Sink] the number of events Sink has not sent.    //
+// --------------------------------------------------------------------------------- //
+static EventStruct EventRing[EVENT_QUEUE_SIZE];
+static unsigned long EventHead = 0;          // events queued
+static unsigned long EventTail[EVENT_Sinks]; // events sent or dropped, by sink
+static unsigned long EventDrop[EVENT_Sinks]; // events dropped because the ring was full, by sink
+static byte EventPeak = 0;                   // most events waiting at once
+
+// Events the slowest sink has not sent yet
+static byte EventBacklog(void)
+{
+  byte Backlog = 0;
+
+  for (byte Sink = 0; Sink < EVENT_Sinks; Sink++)
+    if (EventHead - EventTail[Sink] > Backlog)
+      Backlog = EventHead - EventTail[Sink];
+  return Backlog;
+}
+
+void EventQueue(void)
+{
+  byte Backlog;
+
+  for (byte Sink = 0; Sink < EVENT_Sinks; Sink++)
+    if (EventHead - EventTail[Sink] == EVENT_QUEUE_SIZE)
+    { // full: this sink loses its oldest event
+      EventTail[Sink]++;
+      EventDrop[Sink]++;
+    }
+  EventRing[EventHead++ % EVENT_QUEUE_SIZE] = Event;
+  EventClear();
+
+  Backlog = EventBacklog();
+  if (Backlog > EventPeak)
+    EventPeak = Backlog;
+}
+
+boolean EventFetch(byte Sink)
+{
+  if (EventTail[Sink] == EventHead)
+    return false;
+  Event = EventRing[EventTail[Sink] % EVENT_QUEUE_SIZE];
+  return true;
+}
+
+void EventSent(byte Sink)
+{
+  EventTail[Sink]++;
+}
+#endif
+
 // ------------------- //
 // Display shared func //
 // ------------------- //
@@ -19,321 +499,482 @@ char pbuffer[PRINT_BUFFER_SIZE]; // Buffer for complete message data
 // Common Header
 void display_Header(void)
 {
-  sprintf_P(dbuffer, PSTR("%S%02X"), F("20;"), PKSequenceNumber++);
-  strcat(pbuffer, dbuffer);
+  Event.Sequence = PKSequenceNumber++;
+  Event.Protocol = 0;
+  Event.Complete = false;
+  Event.Truncated = false;
+  Event.Name = NULL;
+  Event.Fields = 0;
+  Event.TextLength = 0;
 }
 
 // Plugin Name
 void display_Name(const char *input)
 {
-  sprintf_P(dbuffer, PSTR(";%S"), input);
-  strcat(pbuffer, dbuffer);
+  Event.Name = input;
 }
 
 // Common Footer
 void display_Footer(void)
 {
-  sprintf_P(dbuffer, PSTR("%S"), F(";\r\n"));
-  strcat(pbuffer, dbuffer);
+  Event.Complete = true;
 }
 
 // Start message
 void display_Splash(void)
 {
-  sprintf_P(dbuffer, PSTR("%S%d.%d"), F(";RFLink_ESP;VER="), BUILDNR, REVNR);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_VERSION, 1, ((unsigned long)BUILDNR << 8) | REVNR);
 }
 
 // ID=9999 => device ID (often a rolling code and/or device channel number) (Hexadecimal)
 void display_IDn(unsigned int input, byte n)
 {
-  switch (n)
-  {
-  case 2:
-    sprintf_P(dbuffer, PSTR("%S%02x"), F(";ID="), input);
-    break;
-  case 4:
-    sprintf_P(dbuffer, PSTR("%S%04x"), F(";ID="), input);
-    break;
-  case 6:
-    sprintf_P(dbuffer, PSTR("%S%06x"), F(";ID="), input);
-    break;
-  case 8:
-  default:
-    sprintf_P(dbuffer, PSTR("%S%08x"), F(";ID="), input);
-  }
-  strcat(pbuffer, dbuffer);
+  if ((n != 2) && (n != 4) && (n != 6))
+    n = 8;
+  EventAdd(EVENT_ID, n, input);
 }
 
 void display_IDc(const char *input)
 {
-  sprintf_P(dbuffer, PSTR("%S"), F(";ID="));
-  strcat(pbuffer, dbuffer);
-  strcat(pbuffer, input);
+  EventAddText(EVENT_IDc, input, 0);
 }
 
 // SWITCH=A16 => House/Unit code like A1, P2, B16 or a button number etc.
 void display_SWITCH(byte input)
 {
-  sprintf_P(dbuffer, PSTR("%S%02x"), F(";SWITCH="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_SWITCH, 2, input);
 }
 
 // SWITCH=A16 => House/Unit code like A1, P2, B16 or a button number etc.
 void display_SWITCHc(const char *input)
 {
-  sprintf_P(dbuffer, PSTR("%S"), F(";SWITCH="));
-  strcat(pbuffer, dbuffer);
-  strcat(pbuffer, input);
+  EventAddText(EVENT_SWITCHc, input, 0);
 }
 
 // CMD=ON => Command (ON/OFF/ALLON/ALLOFF) Additional for Milight: DISCO+/DISCO-/MODE0 - MODE8
 void display_CMD(boolean all, byte on)
 {
-  sprintf_P(dbuffer, PSTR("%S"), F(";CMD="));
-  strcat(pbuffer, dbuffer);
-
-  if (all == CMD_All)
-  {
-    sprintf_P(dbuffer, PSTR("%S"), F("ALL"));
-    strcat(pbuffer, dbuffer);
-  }
-
-  switch (on)
-  {
-  case CMD_On:
-    sprintf_P(dbuffer, PSTR("%S"), F("ON"));
-    break;
-  case CMD_Off:
-    sprintf_P(dbuffer, PSTR("%S"), F("OFF"));
-    break;
-  case CMD_Bright:
-    sprintf_P(dbuffer, PSTR("%S"), F("BRIGHT"));
-    break;
-  case CMD_Dim:
-    sprintf_P(dbuffer, PSTR("%S"), F("DIM"));
-    break;
-  case CMD_Unknown:
-  default:
-    sprintf_P(dbuffer, PSTR("%S"), F("UNKNOWN"));
-  }
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_CMD, 1, ((unsigned long)all << 8) | on);
 }
 
 // SET_LEVEL=15 => Direct dimming level setting value (decimal value: 0-15)
 void display_SET_LEVEL(byte input)
 {
-  sprintf_P(dbuffer, PSTR("%S%02d"), F(";SET_LEVEL="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_SET_LEVEL, 2, input);
 }
 
 // TEMP=9999 => Temperature celcius (hexadecimal), high bit contains negative sign, needs division by 10
 void display_TEMP(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%S%04x"), F(";TEMP="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_TEMP, 4, input);
 }
 
 // HUM=99 => Humidity (decimal value: 0-100 to indicate relative humidity in %)
 void display_HUM(byte input, boolean bcd)
 {
-  if (bcd == HUM_BCD)
-    sprintf_P(dbuffer, PSTR("%S%02x"), F(";HUM="), input);
-  else
-    sprintf_P(dbuffer, PSTR("%S%02d"), F(";HUM="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd((bcd == HUM_BCD) ? EVENT_HUM_BCD : EVENT_HUM, 2, input);
 }
 
 // BARO=9999 => Barometric pressure (hexadecimal)
 void display_BARO(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%S%04x"), F(";BARO="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_BARO, 4, input);
 }
 
 // HSTATUS=99 => 0=Normal, 1=Comfortable, 2=Dry, 3=Wet
 void display_HSTATUS(byte input)
 {
-  sprintf_P(dbuffer, PSTR("%S%02x"), F(";HSTATUS="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_HSTATUS, 2, input);
 }
 
 // BFORECAST=99 => 0=No Info/Unknown, 1=Sunny, 2=Partly Cloudy, 3=Cloudy, 4=Rain
 void display_BFORECAST(byte input)
 {
-  sprintf_P(dbuffer, PSTR("%S%02x"), F(";BFORECAST="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_BFORECAST, 2, input);
 }
 
 // UV=9999 => UV intensity (hexadecimal)
 void display_UV(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%S%04x"), F(";UV="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_UV, 4, input);
 }
 
 // LUX=9999 => Light intensity (hexadecimal)
 void display_LUX(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%S%04x"), F(";LUX="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_LUX, 4, input);
 }
 
 // BAT=OK => Battery status indicator (OK/LOW)
 void display_BAT(boolean input)
 {
-  if (input == true)
-    sprintf_P(dbuffer, PSTR("%S"), F(";BAT=OK"));
-  else
-    sprintf_P(dbuffer, PSTR("%S"), F(";BAT=LOW"));
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_BAT, 1, input == true);
 }
 
 // RAIN=1234 => Total rain in mm. (hexadecimal) 0x8d = 141 decimal = 14.1 mm (needs division by 10)
 void display_RAIN(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%S%04x"), F(";RAIN="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_RAIN, 4, input);
 }
 
 // RAINRATE=1234 => Rain rate in mm. (hexadecimal) 0x8d = 141 decimal = 14.1 mm (needs division by 10)
 void display_RAINRATE(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%S%04x"), F(";RAINRATE="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_RAINRATE, 4, input);
 }
 
 // WINSP=9999 => Wind speed in km. p/h (hexadecimal) needs division by 10
 void display_WINSP(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%S%04x"), F(";WINSP="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_WINSP, 4, input);
 }
 
 // AWINSP=9999 => Average Wind speed in km. p/h (hexadecimal) needs division by 10
 void display_AWINSP(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%S%04x"), F(";AWINSP="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_AWINSP, 4, input);
 }
 
 // WINGS=9999 => Wind Gust in km. p/h (hexadecimal)
 void display_WINGS(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%S%04x"), F(";WINGS="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_WINGS, 4, input);
 }
 
 // WINDIR=123 => Wind direction (integer value from 0-15) reflecting 0-360 degrees in 22.5 degree steps
 void display_WINDIR(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%S%03d"), F(";WINDIR="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_WINDIR, 3, input);
 }
 
 // WINCHL => wind chill (hexadecimal, see TEMP)
 void display_WINCHL(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%S%04x"), F(";WINCHL="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_WINCHL, 4, input);
 }
 
 // WINTMP=1234 => Wind meter temperature reading (hexadecimal, see TEMP)
 void display_WINTMP(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%S%04x"), F(";WINTMP="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_WINTMP, 4, input);
 }
 
 // CHIME=123 => Chime/Doorbell melody number
 void display_CHIME(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%S%03d"), F(";CHIME="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_CHIME, 3, input);
 }
 
 // SMOKEALERT=ON => ON/OFF
 void display_SMOKEALERT(boolean input)
 {
-  if (input == SMOKE_On)
-    sprintf_P(dbuffer, PSTR("%S"), F(";SMOKEALERT=ON"));
-  else
-    sprintf_P(dbuffer, PSTR("%S"), F(";SMOKEALERT=OFF"));
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_SMOKEALERT, 1, input == SMOKE_On);
 }
 
 // PIR=ON => ON/OFF
 void display_PIR(boolean input)
 {
-  if (input == PIR_On)
-    sprintf_P(dbuffer, PSTR("%S"), F(";PIR=ON"));
-  else
-    sprintf_P(dbuffer, PSTR("%S"), F(";PIR=OFF"));
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_PIR, 1, input == PIR_On);
 }
 
 // CO2=1234 => CO2 air quality
 void display_CO2(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%S%04d"), F(";CO2="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_CO2, 4, input);
 }
 
 // SOUND=1234 => Noise level
 void display_SOUND(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%S%04d"), F(";SOUND="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_SOUND, 4, input);
 }
 
 // KWATT=9999 => KWatt (hexadecimal)
 void display_KWATT(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%S%04x"), F(";KWATT="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_KWATT, 4, input);
 }
 
 // WATT=9999 => Watt (hexadecimal)
 void display_WATT(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%S%04x"), F(";WATT="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_WATT, 4, input);
 }
 
 // CURRENT=1234 => Current phase 1
 void display_CURRENT(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%S%04d"), F(";CURRENT="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_CURRENT, 4, input);
 }
 
 // DIST=1234 => Distance
 void display_DIST(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%S%04d"), F(";DIST="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_DIST, 4, input);
 }
 
 // METER=1234 => Meter values (water/electricity etc.)
 void display_METER(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%S%04d"), F(";METER="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_METER, 4, input);
 }
 
 // VOLT=1234 => Voltage
 void display_VOLT(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%S%04d"), F(";VOLT="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_VOLT, 4, input);
 }
 
 // RGBW=9999 => Milight: provides 1 byte color and 1 byte brightness value
 void display_RGBW(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%S%04x"), F(";RGBW="), input);
-  strcat(pbuffer, dbuffer);
+  EventAdd(EVENT_RGBW, 4, input);
+}
+
+// PLUGIN004=ON => Receive plugin state (ON/OFF)
+void display_PLUGIN(byte id, boolean on)
+{
+  EventAdd(EVENT_PLUGIN, 3, ((unsigned long)on << 8) | id);
+}
+
+// ID=004;CALLS=120;OK=12;REJECT=108;KCYCLES=3150 => Receive plugin statistics (decimal values)
+void display_STATS(byte id, unsigned long calls, unsigned long accepts, unsigned long kcycles)
+{
+  EventAdd(EVENT_PLUGIN_ID, 3, id);
+  EventAdd(EVENT_CALLS, 1, calls);
+  EventAdd(EVENT_OK, 1, accepts);
+  EventAdd(EVENT_REJECT, 1, calls - accepts);
+  EventAdd(EVENT_KCYCLES, 1, kcycles);
+}
+
+// Flex1 => Name of the flex decoder that decoded the packet
+void display_FLEX(byte slot)
+{
+  EventAdd(EVENT_FLEX, 1, slot);
+}
+
+// FLEX1=PWM,74,750,1650,36,2,0-7,12-23 => Definition of a flex decoder
+void display_FLEXDEF(byte slot, const char *definition)
+{
+  EventAddText(EVENT_FLEXDEF, definition, slot);
+}
+
+// VALUE=1a2b => Value bits of a flex decoder (Hexadecimal)
+void display_VALUE(unsigned long input)
+{
+  EventAdd(EVENT_VALUE, 1, input);
+}
+
+#ifdef EVENT_QUEUE
+// QUEUED=5120;PEAK=3;DROPSERIAL=0;DROPMQTT=12 => Outbound queue counters: events queued, most waiting at once, dropped by sink (decimal values)
+void display_QUEUE(void)
+{
+  EventAdd(EVENT_QUEUED, 1, EventHead);
+  EventAdd(EVENT_PEAK, 1, EventPeak);
+#ifdef SERIAL_ENABLED
+  EventAdd(EVENT_DROP_SERIAL, 1, EventDrop[EVENT_SINK_SERIAL]);
+#endif
+#if defined(MQTT_ENABLED) && (defined(ESP32) || defined(ESP8266))
+  EventAdd(EVENT_DROP_MQTT, 1, EventDrop[EVENT_SINK_MQTT]);
+#endif
+#ifdef OLED_ENABLED
+  EventAdd(EVENT_DROP_OLED, 1, EventDrop[EVENT_SINK_OLED]);
+#endif
+}
+#endif
+
+#ifdef PUBLISH_CHANGES
+// --------------------------------------------------------------------------------- //
+// Change-only publishing: the device of an event is its name, ID and SWITCH, its    //
+// readings are the other fields. ReadingPublish() compares them with the last ones  //
+// published for that device.                                                        //
+// --------------------------------------------------------------------------------- //
+#define READING_FIELDS 8 // readings kept per device, messages with more are always published
+
+struct ReadingStruct
+{
+  unsigned long Device;               // FNV-1a hash of name, ID and SWITCH
+  byte Fields;                        // number of readings, READING_FIELDS + 1 when there are more
+  byte Kind[READING_FIELDS];          // EVENT_Kind of each reading
+  unsigned int Value[READING_FIELDS]; // readings in display order
+};
+
+struct PublishedStruct // last readings published for a device
+{
+  unsigned long Device;    // 0 when the entry is free
+  unsigned long Published; // millis() of the last message published
+  unsigned long Seen;      // millis() of the last message, published or not
+  byte Fields;
+  unsigned int Value[READING_FIELDS];
+} PublishedTable[PUBLISH_DEVICES];
+
+unsigned long PublishChanged = 0;    // readings published because they changed (or the device is new)
+unsigned long PublishHeartbeat = 0;  // unchanged readings published after PUBLISH_HEARTBEAT_MS
+unsigned long PublishSuppressed = 0; // unchanged readings dropped
+
+// DEVICES=12;CHANGED=340;HEARTBEAT=96;SUPPRESSED=2210 => Change-only publishing counters (decimal values)
+void display_PUBLISH(void)
+{
+  byte Devices = 0;
+
+  for (byte x = 0; x < PUBLISH_DEVICES; x++)
+    if (PublishedTable[x].Device)
+      Devices++;
+  EventAdd(EVENT_DEVICES, 1, Devices);
+  EventAdd(EVENT_CHANGED, 1, PublishChanged);
+  EventAdd(EVENT_HEARTBEAT, 1, PublishHeartbeat);
+  EventAdd(EVENT_SUPPRESSED, 1, PublishSuppressed);
+}
+
+static inline void ReadingHash(ReadingStruct *Reading, byte c)
+{
+  Reading->Device = (Reading->Device ^ c) * 16777619UL;
+}
+
+static void ReadingAdd(ReadingStruct *Reading, byte Kind, unsigned int Value)
+{
+  if (Reading->Fields < READING_FIELDS)
+  {
+    Reading->Kind[Reading->Fields] = Kind;
+    Reading->Value[Reading->Fields] = Value;
+  }
+  if (Reading->Fields <= READING_FIELDS)
+    Reading->Fields++;
+}
+
+// Device and readings of Event, false when it has a command, alarm, chime...: always published
+static boolean ReadingCollect(ReadingStruct *Reading)
+{
+  const char *Text;
+  char c;
+
+  Reading->Device = 2166136261UL;
+  Reading->Fields = 0;
+  if ((Text = Event.Name) != NULL)
+    while ((c = pgm_read_byte(Text++)))
+      ReadingHash(Reading, c);
+
+  for (byte x = 0; x < Event.Fields; x++)
+  {
+    const EventFieldStruct *Field = &Event.Field[x];
+    unsigned long Value = Field->Value;
+
+    switch (pgm_read_byte(&Event_table[Field->Type].Kind))
+    {
+    case KIND_EVENT:
+      return false;
+    case KIND_KEY:
+      ReadingHash(Reading, Field->Type);
+      if (pgm_read_byte(&Event_table[Field->Type].Format) == FORMAT_TEXT)
+        for (Text = Event.Text + (Value >> 8); *Text; Text++)
+          ReadingHash(Reading, *Text);
+      else
+        for (byte b = 0; b < sizeof(Value); b++, Value >>= 8)
+          ReadingHash(Reading, Value);
+      break;
+    case KIND_HUM_BCD:
+      ReadingAdd(Reading, KIND_HUM, (Value >> 4) * 10 + (Value & 0xF));
+      break;
+    case KIND_LONG:
+      ReadingAdd(Reading, KIND_EXACT, Value >> 16);
+      ReadingAdd(Reading, KIND_EXACT, Value);
+      break;
+    case KIND_TEMP:
+      ReadingAdd(Reading, KIND_TEMP, Value);
+      break;
+    case KIND_HUM:
+      ReadingAdd(Reading, KIND_HUM, Value);
+      break;
+    default:
+      ReadingAdd(Reading, KIND_EXACT, Value);
+    }
+  }
+  return true;
+}
+
+/*********************************************************************************************\
+   Change-only publishing of the decoded Event. Events without readings, or with a command,
+   alarm, chime..., always go out. Readings go out when the device is new, when one of them
+   moved away from the last published value (by PUBLISH_DELTA_TEMP / _HUM for temperatures
+   and humidity, by anything for the others), or after PUBLISH_HEARTBEAT_MS.
+   Else Event is dropped before any sink formats it, and its sequence number given back.
+  \*********************************************************************************************/
+static boolean ReadingChanged(const PublishedStruct *Entry, const ReadingStruct *Reading)
+{
+  int Now, Last;
+
+  if (Entry->Fields != Reading->Fields)
+    return true;
+  for (byte x = 0; x < Reading->Fields; x++)
+  {
+    Now = Reading->Value[x];
+    Last = Entry->Value[x];
+    switch (Reading->Kind[x])
+    {
+    case KIND_TEMP: // high bit is the sign
+      if (Now & 0x8000)
+        Now = -(Now & 0x7FFF);
+      if (Last & 0x8000)
+        Last = -(Last & 0x7FFF);
+      if (abs(Now - Last) >= PUBLISH_DELTA_TEMP)
+        return true;
+      break;
+    case KIND_HUM:
+      if (abs(Now - Last) >= PUBLISH_DELTA_HUM)
+        return true;
+      break;
+    default:
+      if (Now != Last)
+        return true;
+    }
+  }
+  return false;
+}
+
+void ReadingPublish(void)
+{
+  unsigned long Now = millis();
+  PublishedStruct *Entry = NULL;
+  ReadingStruct Reading;
+  byte x;
+
+  if (!Event.Complete || !ReadingCollect(&Reading) || (Reading.Fields == 0) || (Reading.Fields > READING_FIELDS))
+    return;
+
+  for (x = 0; x < PUBLISH_DEVICES; x++)
+    if (PublishedTable[x].Device == Reading.Device)
+    {
+      Entry = &PublishedTable[x];
+      break;
+    }
+
+  if (Entry == NULL)
+  { // new device, in a free entry or in place of the one not seen for the longest time
+    Entry = &PublishedTable[0];
+    for (x = 0; (x < PUBLISH_DEVICES) && Entry->Device; x++)
+      if ((PublishedTable[x].Device == 0) || (Now - PublishedTable[x].Seen > Now - Entry->Seen))
+        Entry = &PublishedTable[x];
+    Entry->Device = Reading.Device;
+    PublishChanged++;
+  }
+  else if (ReadingChanged(Entry, &Reading))
+    PublishChanged++;
+  else if (Now - Entry->Published >= PUBLISH_HEARTBEAT_MS)
+    PublishHeartbeat++;
+  else
+  {
+    Entry->Seen = Now;
+    PublishSuppressed++;
+    PKSequenceNumber--; // keep the sequence numbers of what is published consecutive
+    EventClear();
+    return;
+  }
+
+  Entry->Published = Entry->Seen = Now;
+  Entry->Fields = Reading.Fields;
+  memcpy(Entry->Value, Reading.Value, sizeof(Entry->Value));
 }
+#endif
 
 /*********************************************************************************************\
    Convert string to command code
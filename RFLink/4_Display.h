@@ -10,10 +10,89 @@
 
 #include <Arduino.h>
 #include "RFLink.h"
+#include "4_Display_Types.h"
 
 // extern byte PKSequenceNumber;     // 1 byte packet counter
 extern char pbuffer[PRINT_BUFFER_SIZE]; // Buffer for printing data
 
+// ***********************************************************************************
+// The display_* functions do not print: they add typed fields to Event, from display_Header()
+// to display_Footer(). Each sink formats the record its own way when it sends it, the
+// 20;xx;Name;FIELD=value;... line for Serial and MQTT, one field per line for the OLED.
+// ***********************************************************************************
+#define EVENT_FIELDS 12 // fields kept per message, the next ones are dropped and the event marked Truncated
+// Fields of the widest message a plugin sends (Plugin_029, Plugin_041), checked against the
+// plugin sources by tools/host_sim (make check)
+#define EVENT_FIELDS_WIDEST 8
+#if EVENT_FIELDS < EVENT_FIELDS_WIDEST
+#error "EVENT_FIELDS too small for the widest plugin message"
+#endif
+#ifdef FLEX_DECODER
+#define EVENT_TEXT_SIZE 64 // texts of IDc, SWITCHc and FLEXDEF fields
+#else
+#define EVENT_TEXT_SIZE 16
+#endif
+
+// The values of EVENT_Type are sent in SERIAL_BINARY frames: new types go at the end of EVENT_TYPES
+#define EVENT_TYPE(Name, Label, Format, Kind, Json) EVENT_##Name,
+enum EVENT_Type {EVENT_TYPES EVENT_Types};
+#undef EVENT_TYPE
+
+struct EventFieldStruct
+{
+  byte Type;           // EVENT_Type
+  byte Digits;         // minimum number of digits
+  unsigned long Value; // offset in Event.Text for texts
+};
+
+struct EventStruct
+{
+  byte Sequence;     // xx of 20;xx;
+  byte Protocol;     // Plugin_id() of the plugin that decoded the event, 0 for the other messages
+  boolean Complete;  // display_Footer() done, not sent yet
+  boolean Truncated; // fields or text dropped, Field[] or Text[] was full
+  const char *Name;  // in PROGMEM, NULL when the message has none
+  byte Fields;
+  EventFieldStruct Field[EVENT_FIELDS];
+  byte TextLength;
+  char Text[EVENT_TEXT_SIZE];
+};
+extern EventStruct Event;
+extern unsigned long EventTruncated; // events that lost fields or text
+
+void EventClear(void); // Event sent or dropped
+void EventTruncate(void); // Event lost fields or text, counted once in EventTruncated
+const char *EventFieldText(const EventFieldStruct *Field); // IDc, SWITCHc and FLEXDEF text, NULL for the other fields
+void EventText(void);  // 20;xx;Name;FIELD=value;...;\r\n in pbuffer
+void EventLines(void); // Name and FIELD=value lines in pbuffer
+#ifdef MQTT_JSON
+void EventTopic(char *Topic, unsigned int Size, const char *Prefix); // Prefix/<name>/<ID>[/<SWITCH>]
+void EventJSON(char *Payload, unsigned int Size);                    // {"temp":21.0,"hum":55,"bat":"ok"}
+#endif
+
+#ifdef EVENT_QUEUE
+// ***********************************************************************************
+// Outbound queue: sendMsg() copies Event into a ring of EVENT_QUEUE_SIZE events, and each
+// sink takes them from there at its own pace (sendQueue() in RFLink.ino). When the ring is
+// full, the oldest event is dropped for the sinks that have not sent it yet, and counted.
+// ***********************************************************************************
+enum EVENT_Sink {
+#ifdef SERIAL_ENABLED
+  EVENT_SINK_SERIAL,
+#endif
+#if defined(MQTT_ENABLED) && (defined(ESP32) || defined(ESP8266))
+  EVENT_SINK_MQTT,
+#endif
+#ifdef OLED_ENABLED
+  EVENT_SINK_OLED,
+#endif
+  EVENT_Sinks};
+
+void EventQueue(void);         // Event into the ring, then cleared
+boolean EventFetch(byte Sink); // next event of Sink into Event, false when there is none
+void EventSent(byte Sink);     // Sink is done with the event fetched
+#endif
+
 void display_Header(void);
 void display_Name(const char *);
 void display_Footer(void);
@@ -22,8 +101,6 @@ void display_IDn(unsigned int, byte);
 void display_IDc(const char *);
 void display_SWITCH(byte);
 void display_SWITCHc(const char *);
-enum CMD_Group {CMD_Single, CMD_All}; 
-enum CMD_OnOff {CMD_Off, CMD_On, CMD_Bright, CMD_Dim, CMD_Unknown}; 
 void display_CMD(boolean, byte);
 void display_SET_LEVEL(byte);
 void display_TEMP(unsigned int);
@@ -57,6 +134,18 @@ void display_DIST(unsigned int);
 void display_METER(unsigned int);
 void display_VOLT(unsigned int);
 void display_RGBW(unsigned int);
+void display_PLUGIN(byte, boolean);
+void display_STATS(byte, unsigned long, unsigned long, unsigned long);
+void display_FLEX(byte);
+void display_FLEXDEF(byte, const char *);
+void display_VALUE(unsigned long);
+#ifdef PUBLISH_CHANGES
+void display_PUBLISH(void);
+void ReadingPublish(void); // drops Event when it repeats the last readings published for the device
+#endif
+#ifdef EVENT_QUEUE
+void display_QUEUE(void);
+#endif
 
 // int str2cmd(char *command)
 void replacechar(char *, char, char);
@@ -0,0 +1,83 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef Display_Types_h
+#define Display_Types_h
+
+// ***********************************************************************************
+// The event field types, in EVENT_Type order. 4_Display.h makes EVENT_Type of it,
+// 4_Display.cpp Event_table[] and tools/rflink_text its decoding table, so that the
+// SERIAL_BINARY type codes agree on both sides. New types go at the end. The value
+// formats below are shared the same way.
+// EVENT_TYPE(Name, Label, Format, Kind, Json): EVENT_<Name>, label printed, FORMAT_<Format>,
+// KIND_<Kind> for change-only publishing, JSON_<Json> for MQTT_JSON (see 4_Display.cpp)
+// ***********************************************************************************
+#define EVENT_TYPES \
+  EVENT_TYPE(ID, "ID", HEX, KEY, NONE) \
+  EVENT_TYPE(IDc, "ID", TEXT, KEY, NONE) \
+  EVENT_TYPE(SWITCH, "SWITCH", HEX, KEY, NONE) \
+  EVENT_TYPE(SWITCHc, "SWITCH", TEXT, KEY, NONE) \
+  EVENT_TYPE(CMD, "CMD", CMD, EVENT, TEXT) \
+  EVENT_TYPE(SET_LEVEL, "SET_LEVEL", DEC, EVENT, INT) \
+  EVENT_TYPE(TEMP, "TEMP", HEX, TEMP, TEMP) \
+  EVENT_TYPE(HUM, "HUM", DEC, HUM, INT) \
+  EVENT_TYPE(HUM_BCD, "HUM", HEX, HUM_BCD, BCD) \
+  EVENT_TYPE(BARO, "BARO", HEX, EXACT, INT) \
+  EVENT_TYPE(HSTATUS, "HSTATUS", HEX, EXACT, INT) \
+  EVENT_TYPE(BFORECAST, "BFORECAST", HEX, EXACT, INT) \
+  EVENT_TYPE(UV, "UV", HEX, EXACT, INT) \
+  EVENT_TYPE(LUX, "LUX", HEX, EXACT, INT) \
+  EVENT_TYPE(BAT, "BAT", OKLOW, EXACT, TEXT) \
+  EVENT_TYPE(RAIN, "RAIN", HEX, EXACT, TENTH) \
+  EVENT_TYPE(RAINRATE, "RAINRATE", HEX, EXACT, TENTH) \
+  EVENT_TYPE(WINSP, "WINSP", HEX, EXACT, TENTH) \
+  EVENT_TYPE(AWINSP, "AWINSP", HEX, EXACT, TENTH) \
+  EVENT_TYPE(WINGS, "WINGS", HEX, EXACT, INT) \
+  EVENT_TYPE(WINDIR, "WINDIR", DEC, EXACT, DIR) \
+  EVENT_TYPE(WINCHL, "WINCHL", HEX, TEMP, TEMP) \
+  EVENT_TYPE(WINTMP, "WINTMP", HEX, TEMP, TEMP) \
+  EVENT_TYPE(CHIME, "CHIME", DEC, EVENT, INT) \
+  EVENT_TYPE(SMOKEALERT, "SMOKEALERT", ONOFF, EVENT, TEXT) \
+  EVENT_TYPE(PIR, "PIR", ONOFF, EVENT, TEXT) \
+  EVENT_TYPE(CO2, "CO2", DEC, EXACT, INT) \
+  EVENT_TYPE(SOUND, "SOUND", DEC, EXACT, INT) \
+  EVENT_TYPE(KWATT, "KWATT", HEX, EXACT, INT) \
+  EVENT_TYPE(WATT, "WATT", HEX, EXACT, INT) \
+  EVENT_TYPE(CURRENT, "CURRENT", DEC, EXACT, INT) \
+  EVENT_TYPE(DIST, "DIST", DEC, EXACT, INT) \
+  EVENT_TYPE(METER, "METER", DEC, EXACT, INT) \
+  EVENT_TYPE(VOLT, "VOLT", DEC, EXACT, INT) \
+  EVENT_TYPE(RGBW, "RGBW", HEX, EVENT, INT) \
+  EVENT_TYPE(FLEX, "Flex", NAME, KEY, NONE) \
+  EVENT_TYPE(VALUE, "VALUE", HEX, LONG, INT) \
+  EVENT_TYPE(VERSION, "VER", VERSION, EXACT, NONE) \
+  EVENT_TYPE(PLUGIN, "PLUGIN", PLUGIN, EXACT, NONE) \
+  EVENT_TYPE(FLEXDEF, "FLEX", FLEXDEF, EXACT, NONE) \
+  EVENT_TYPE(PLUGIN_ID, "ID", DEC, EXACT, INT) \
+  EVENT_TYPE(CALLS, "CALLS", DEC, EXACT, INT) \
+  EVENT_TYPE(OK, "OK", DEC, EXACT, INT) \
+  EVENT_TYPE(REJECT, "REJECT", DEC, EXACT, INT) \
+  EVENT_TYPE(KCYCLES, "KCYCLES", DEC, EXACT, INT) \
+  EVENT_TYPE(DEVICES, "DEVICES", DEC, EXACT, INT) \
+  EVENT_TYPE(CHANGED, "CHANGED", DEC, EXACT, INT) \
+  EVENT_TYPE(HEARTBEAT, "HEARTBEAT", DEC, EXACT, INT) \
+  EVENT_TYPE(SUPPRESSED, "SUPPRESSED", DEC, EXACT, INT) \
+  EVENT_TYPE(QUEUED, "QUEUED", DEC, EXACT, INT) \
+  EVENT_TYPE(PEAK, "PEAK", DEC, EXACT, INT) \
+  EVENT_TYPE(DROP_SERIAL, "DROPSERIAL", DEC, EXACT, INT) \
+  EVENT_TYPE(DROP_MQTT, "DROPMQTT", DEC, EXACT, INT) \
+  EVENT_TYPE(DROP_OLED, "DROPOLED", DEC, EXACT, INT)
+
+// How a field value is printed
+enum EVENT_Format {FORMAT_HEX, FORMAT_DEC, FORMAT_TEXT, FORMAT_ONOFF, FORMAT_OKLOW, FORMAT_CMD,
+                   FORMAT_NAME, FORMAT_VERSION, FORMAT_PLUGIN, FORMAT_FLEXDEF};
+
+// CMD field value: CMD_Group << 8 | CMD_OnOff, see display_CMD()
+enum CMD_Group {CMD_Single, CMD_All};
+enum CMD_OnOff {CMD_Off, CMD_On, CMD_Bright, CMD_Dim, CMD_Unknown};
+
+#endif // Display_Types_h
@@ -9,10 +9,20 @@
 #include "RFLink.h"
 #include "2_Signal.h"
 #include "5_Plugin.h"
+#include "4_Display.h"
+#include "5_Plugin_Flex.h"
+#ifdef PLUGIN_STATE_EEPROM
+#include <EEPROM.h>
+#include "7_Utils.h"
+#endif
 
-boolean (*Plugin_ptr[PLUGIN_MAX])(byte, char *); // Receive plugins
-byte Plugin_id[PLUGIN_MAX];
-byte Plugin_State[PLUGIN_MAX];
+#ifdef PLUGIN_DISPATCH_TABLE
+// Plugins that accept n pulses are Dispatch_list[Dispatch_first[n]] .. Dispatch_list[Dispatch_first[n + 1] - 1],
+// in plugin order, or reordered by PluginPromote() with PLUGIN_ADAPTIVE_ORDER
+unsigned int Dispatch_first[RAW_BUFFER_SIZE + 2];
+byte Dispatch_list[PLUGIN_DISPATCH_SIZE];
+boolean Dispatch_ready = false; // table did fit in Dispatch_list[]
+#endif
 
 boolean RFDebug = RFDebug_0;     // debug RF signals with plugin 001 (no decode)
 boolean QRFDebug = QRFDebug_0;   // debug RF signals with plugin 001 but no multiplication (faster?, compact)
@@ -28,1157 +38,350 @@ boolean QRFUDebug = QRFUDebug_0; // debug RF signals with plugin 254 but no mult
 #define stringify(x) #x
 #define PLUGINFILE(a, b) stringify(a/Plugins/b) // no space in "stringify(a/Plugins/b)"
 
-#ifdef PLUGIN_001
+// Plugin files only hold #defines when their PLUGIN_xxx is not enabled in _Plugin_Config_01.h
 #include PLUGINFILE(SKETCH_PATH, Plugin_001.c)
-#endif
-
-#ifdef PLUGIN_002
 #include PLUGINFILE(SKETCH_PATH, Plugin_002.c)
-#endif
-
-#ifdef PLUGIN_003
 #include PLUGINFILE(SKETCH_PATH, Plugin_003.c)
-#endif
-
-#ifdef PLUGIN_004
 #include PLUGINFILE(SKETCH_PATH, Plugin_004.c)
-#endif
-
-#ifdef PLUGIN_005
 #include PLUGINFILE(SKETCH_PATH, Plugin_005.c)
-#endif
-
-#ifdef PLUGIN_006
 #include PLUGINFILE(SKETCH_PATH, Plugin_006.c)
-#endif
-
-#ifdef PLUGIN_007
 #include PLUGINFILE(SKETCH_PATH, Plugin_007.c)
-#endif
-
-#ifdef PLUGIN_008
 #include PLUGINFILE(SKETCH_PATH, Plugin_008.c)
-#endif
-
-#ifdef PLUGIN_009
 #include PLUGINFILE(SKETCH_PATH, Plugin_009.c)
-#endif
-
-#ifdef PLUGIN_010
 #include PLUGINFILE(SKETCH_PATH, Plugin_010.c)
-#endif
-
-#ifdef PLUGIN_011
 #include PLUGINFILE(SKETCH_PATH, Plugin_011.c)
-#endif
-
-#ifdef PLUGIN_012
 #include PLUGINFILE(SKETCH_PATH, Plugin_012.c)
-#endif
-
-#ifdef PLUGIN_013
 #include PLUGINFILE(SKETCH_PATH, Plugin_013.c)
-#endif
-
-#ifdef PLUGIN_014
 #include PLUGINFILE(SKETCH_PATH, Plugin_014.c)
-#endif
-
-#ifdef PLUGIN_015
 #include PLUGINFILE(SKETCH_PATH, Plugin_015.c)
-#endif
-
-#ifdef PLUGIN_016
-#include PLUGINFILE(SKETCH_PATH, Plugin_016.c)
-#endif
-
-#ifdef PLUGIN_017
-#include PLUGINFILE(SKETCH_PATH, Plugin_017.c)
-#endif
-
-#ifdef PLUGIN_018
-#include PLUGINFILE(SKETCH_PATH, Plugin_018.c)
-#endif
-
-#ifdef PLUGIN_019
-#include PLUGINFILE(SKETCH_PATH, Plugin_019.c)
-#endif
-
-#ifdef PLUGIN_020
-#include PLUGINFILE(SKETCH_PATH, Plugin_020.c)
-#endif
-
-#ifdef PLUGIN_021
-#include PLUGINFILE(SKETCH_PATH, Plugin_021.c)
-#endif
-
-#ifdef PLUGIN_022
-#include PLUGINFILE(SKETCH_PATH, Plugin_022.c)
-#endif
-
-#ifdef PLUGIN_023
-#include PLUGINFILE(SKETCH_PATH, Plugin_023.c)
-#endif
-
-#ifdef PLUGIN_024
-#include PLUGINFILE(SKETCH_PATH, Plugin_024.c)
-#endif
-
-#ifdef PLUGIN_025
-#include PLUGINFILE(SKETCH_PATH, Plugin_025.c)
-#endif
-
-#ifdef PLUGIN_026
-#include PLUGINFILE(SKETCH_PATH, Plugin_026.c)
-#endif
-
-#ifdef PLUGIN_027
-#include PLUGINFILE(SKETCH_PATH, Plugin_027.c)
-#endif
-
-#ifdef PLUGIN_028
-#include PLUGINFILE(SKETCH_PATH, Plugin_028.c)
-#endif
-
-#ifdef PLUGIN_029
 #include PLUGINFILE(SKETCH_PATH, Plugin_029.c)
-#endif
-
-#ifdef PLUGIN_030
 #include PLUGINFILE(SKETCH_PATH, Plugin_030.c)
-#endif
-
-#ifdef PLUGIN_031
 #include PLUGINFILE(SKETCH_PATH, Plugin_031.c)
-#endif
-
-#ifdef PLUGIN_032
 #include PLUGINFILE(SKETCH_PATH, Plugin_032.c)
-#endif
-
-#ifdef PLUGIN_033
 #include PLUGINFILE(SKETCH_PATH, Plugin_033.c)
-#endif
-
-#ifdef PLUGIN_034
 #include PLUGINFILE(SKETCH_PATH, Plugin_034.c)
-#endif
-
-#ifdef PLUGIN_035
 #include PLUGINFILE(SKETCH_PATH, Plugin_035.c)
-#endif
-
-#ifdef PLUGIN_036
-#include PLUGINFILE(SKETCH_PATH, Plugin_036.c)
-#endif
-
-#ifdef PLUGIN_037
-#include PLUGINFILE(SKETCH_PATH, Plugin_037.c)
-#endif
-
-#ifdef PLUGIN_038
-#include PLUGINFILE(SKETCH_PATH, Plugin_038.c)
-#endif
-
-#ifdef PLUGIN_039
-#include PLUGINFILE(SKETCH_PATH, Plugin_039.c)
-#endif
-
-#ifdef PLUGIN_040
 #include PLUGINFILE(SKETCH_PATH, Plugin_040.c)
-#endif
-
-#ifdef PLUGIN_041
 #include PLUGINFILE(SKETCH_PATH, Plugin_041.c)
-#endif
-
-#ifdef PLUGIN_042
 #include PLUGINFILE(SKETCH_PATH, Plugin_042.c)
-#endif
-
-#ifdef PLUGIN_043
 #include PLUGINFILE(SKETCH_PATH, Plugin_043.c)
-#endif
-
-#ifdef PLUGIN_044
 #include PLUGINFILE(SKETCH_PATH, Plugin_044.c)
-#endif
-
-#ifdef PLUGIN_045
 #include PLUGINFILE(SKETCH_PATH, Plugin_045.c)
-#endif
-
-#ifdef PLUGIN_046
 #include PLUGINFILE(SKETCH_PATH, Plugin_046.c)
-#endif
-
-#ifdef PLUGIN_047
 #include PLUGINFILE(SKETCH_PATH, Plugin_047.c)
-#endif
-
-#ifdef PLUGIN_048
-#include PLUGINFILE(SKETCH_PATH, Plugin_048.c)
-#endif
-
-#ifdef PLUGIN_049
-#include PLUGINFILE(SKETCH_PATH, Plugin_049.c)
-#endif
-
-#ifdef PLUGIN_050
-#include PLUGINFILE(SKETCH_PATH, Plugin_050.c)
-#endif
-
-#ifdef PLUGIN_051
-#include PLUGINFILE(SKETCH_PATH, Plugin_051.c)
-#endif
-
-#ifdef PLUGIN_052
-#include PLUGINFILE(SKETCH_PATH, Plugin_052.c)
-#endif
-
-#ifdef PLUGIN_053
-#include PLUGINFILE(SKETCH_PATH, Plugin_053.c)
-#endif
-
-#ifdef PLUGIN_054
-#include PLUGINFILE(SKETCH_PATH, Plugin_054.c)
-#endif
-
-#ifdef PLUGIN_055
-#include PLUGINFILE(SKETCH_PATH, Plugin_055.c)
-#endif
-
-#ifdef PLUGIN_056
-#include PLUGINFILE(SKETCH_PATH, Plugin_056.c)
-#endif
-
-#ifdef PLUGIN_057
-#include PLUGINFILE(SKETCH_PATH, Plugin_057.c)
-#endif
-
-#ifdef PLUGIN_058
-#include PLUGINFILE(SKETCH_PATH, Plugin_058.c)
-#endif
-
-#ifdef PLUGIN_059
-#include PLUGINFILE(SKETCH_PATH, Plugin_059.c)
-#endif
-
-#ifdef PLUGIN_060
 #include PLUGINFILE(SKETCH_PATH, Plugin_060.c)
-#endif
-
-#ifdef PLUGIN_061
 #include PLUGINFILE(SKETCH_PATH, Plugin_061.c)
-#endif
-
-#ifdef PLUGIN_062
 #include PLUGINFILE(SKETCH_PATH, Plugin_062.c)
-#endif
-
-#ifdef PLUGIN_063
 #include PLUGINFILE(SKETCH_PATH, Plugin_063.c)
-#endif
-
-#ifdef PLUGIN_064
-#include PLUGINFILE(SKETCH_PATH, Plugin_064.c)
-#endif
-
-#ifdef PLUGIN_065
-#include PLUGINFILE(SKETCH_PATH, Plugin_065.c)
-#endif
-
-#ifdef PLUGIN_066
-#include PLUGINFILE(SKETCH_PATH, Plugin_066.c)
-#endif
-
-#ifdef PLUGIN_067
-#include PLUGINFILE(SKETCH_PATH, Plugin_067.c)
-#endif
-
-#ifdef PLUGIN_068
-#include PLUGINFILE(SKETCH_PATH, Plugin_068.c)
-#endif
-
-#ifdef PLUGIN_069
-#include PLUGINFILE(SKETCH_PATH, Plugin_069.c)
-#endif
-
-#ifdef PLUGIN_070
 #include PLUGINFILE(SKETCH_PATH, Plugin_070.c)
-#endif
-
-#ifdef PLUGIN_071
 #include PLUGINFILE(SKETCH_PATH, Plugin_071.c)
-#endif
-
-#ifdef PLUGIN_072
 #include PLUGINFILE(SKETCH_PATH, Plugin_072.c)
-#endif
-
-#ifdef PLUGIN_073
 #include PLUGINFILE(SKETCH_PATH, Plugin_073.c)
-#endif
-
-#ifdef PLUGIN_074
 #include PLUGINFILE(SKETCH_PATH, Plugin_074.c)
-#endif
-
-#ifdef PLUGIN_075
 #include PLUGINFILE(SKETCH_PATH, Plugin_075.c)
-#endif
-
-#ifdef PLUGIN_076
-#include PLUGINFILE(SKETCH_PATH, Plugin_076.c)
-#endif
-
-#ifdef PLUGIN_077
-#include PLUGINFILE(SKETCH_PATH, Plugin_077.c)
-#endif
-
-#ifdef PLUGIN_078
-#include PLUGINFILE(SKETCH_PATH, Plugin_078.c)
-#endif
-
-#ifdef PLUGIN_079
-#include PLUGINFILE(SKETCH_PATH, Plugin_079.c)
-#endif
-
-#ifdef PLUGIN_080
 #include PLUGINFILE(SKETCH_PATH, Plugin_080.c)
-#endif
-
-#ifdef PLUGIN_081
 #include PLUGINFILE(SKETCH_PATH, Plugin_081.c)
-#endif
-
-#ifdef PLUGIN_082
 #include PLUGINFILE(SKETCH_PATH, Plugin_082.c)
-#endif
-
-#ifdef PLUGIN_083
-#include PLUGINFILE(SKETCH_PATH, Plugin_083.c)
-#endif
-
-#ifdef PLUGIN_084
-#include PLUGINFILE(SKETCH_PATH, Plugin_084.c)
-#endif
-
-#ifdef PLUGIN_085
-#include PLUGINFILE(SKETCH_PATH, Plugin_085.c)
-#endif
-
-#ifdef PLUGIN_086
-#include PLUGINFILE(SKETCH_PATH, Plugin_086.c)
-#endif
-
-#ifdef PLUGIN_087
-#include PLUGINFILE(SKETCH_PATH, Plugin_087.c)
-#endif
-
-#ifdef PLUGIN_088
-#include PLUGINFILE(SKETCH_PATH, Plugin_088.c)
-#endif
-
-#ifdef PLUGIN_089
-#include PLUGINFILE(SKETCH_PATH, Plugin_089.c)
-#endif
-
-#ifdef PLUGIN_090
-#include PLUGINFILE(SKETCH_PATH, Plugin_090.c)
-#endif
-
-#ifdef PLUGIN_091
-#include PLUGINFILE(SKETCH_PATH, Plugin_091.c)
-#endif
-
-#ifdef PLUGIN_092
-#include PLUGINFILE(SKETCH_PATH, Plugin_092.c)
-#endif
-
-#ifdef PLUGIN_093
-#include PLUGINFILE(SKETCH_PATH, Plugin_093.c)
-#endif
-
-#ifdef PLUGIN_094
-#include PLUGINFILE(SKETCH_PATH, Plugin_094.c)
-#endif
-
-#ifdef PLUGIN_095
-#include PLUGINFILE(SKETCH_PATH, Plugin_095.c)
-#endif
-
-#ifdef PLUGIN_096
-#include PLUGINFILE(SKETCH_PATH, Plugin_096.c)
-#endif
-
-#ifdef PLUGIN_097
-#include PLUGINFILE(SKETCH_PATH, Plugin_097.c)
-#endif
-
-#ifdef PLUGIN_098
-#include PLUGINFILE(SKETCH_PATH, Plugin_098.c)
-#endif
-
-#ifdef PLUGIN_099
-#include PLUGINFILE(SKETCH_PATH, Plugin_099.c)
-#endif
-
-#ifdef PLUGIN_100
-#include PLUGINFILE(SKETCH_PATH, Plugin_100.c)
-#endif
-
-#ifdef PLUGIN_101
-#include PLUGINFILE(SKETCH_PATH, Plugin_101.c)
-#endif
-
-#ifdef PLUGIN_102
-#include PLUGINFILE(SKETCH_PATH, Plugin_102.c)
-#endif
-
-#ifdef PLUGIN_103
-#include PLUGINFILE(SKETCH_PATH, Plugin_103.c)
-#endif
-
-#ifdef PLUGIN_104
-#include PLUGINFILE(SKETCH_PATH, Plugin_104.c)
-#endif
-
-#ifdef PLUGIN_105
-#include PLUGINFILE(SKETCH_PATH, Plugin_105.c)
-#endif
-
-#ifdef PLUGIN_106
-#include PLUGINFILE(SKETCH_PATH, Plugin_106.c)
-#endif
-
-#ifdef PLUGIN_107
-#include PLUGINFILE(SKETCH_PATH, Plugin_107.c)
-#endif
-
-#ifdef PLUGIN_108
-#include PLUGINFILE(SKETCH_PATH, Plugin_108.c)
-#endif
-
-#ifdef PLUGIN_109
-#include PLUGINFILE(SKETCH_PATH, Plugin_109.c)
-#endif
-
-#ifdef PLUGIN_110
-#include PLUGINFILE(SKETCH_PATH, Plugin_110.c)
-#endif
-
-#ifdef PLUGIN_111
-#include PLUGINFILE(SKETCH_PATH, Plugin_111.c)
-#endif
-
-#ifdef PLUGIN_112
-#include PLUGINFILE(SKETCH_PATH, Plugin_112.c)
-#endif
-
-#ifdef PLUGIN_113
-#include PLUGINFILE(SKETCH_PATH, Plugin_113.c)
-#endif
-
-#ifdef PLUGIN_114
-#include PLUGINFILE(SKETCH_PATH, Plugin_114.c)
-#endif
-
-#ifdef PLUGIN_115
-#include PLUGINFILE(SKETCH_PATH, Plugin_115.c)
-#endif
-
-#ifdef PLUGIN_116
-#include PLUGINFILE(SKETCH_PATH, Plugin_116.c)
-#endif
-
-#ifdef PLUGIN_117
-#include PLUGINFILE(SKETCH_PATH, Plugin_117.c)
-#endif
-
-#ifdef PLUGIN_118
-#include PLUGINFILE(SKETCH_PATH, Plugin_118.c)
-#endif
-
-#ifdef PLUGIN_119
-#include PLUGINFILE(SKETCH_PATH, Plugin_119.c)
-#endif
-
-#ifdef PLUGIN_120
-#include PLUGINFILE(SKETCH_PATH, Plugin_120.c)
-#endif
-
-#ifdef PLUGIN_250
-#include PLUGINFILE(SKETCH_PATH, Plugin_250.c)
-#endif
-
-#ifdef PLUGIN_251
-#include PLUGINFILE(SKETCH_PATH, Plugin_251.c)
-#endif
-
-#ifdef PLUGIN_252
-#include PLUGINFILE(SKETCH_PATH, Plugin_252.c)
-#endif
-
-#ifdef PLUGIN_253
-#include PLUGINFILE(SKETCH_PATH, Plugin_253.c)
-#endif
-
-#ifdef PLUGIN_254
-#include PLUGINFILE(SKETCH_PATH, Plugin_254.c)
-#endif
-
-#ifdef PLUGIN_255
-#include PLUGINFILE(SKETCH_PATH, Plugin_255.c)
-#endif
-/*********************************************************************************************/
-void PluginInit(void)
-{
-  byte x;
-
-  // Wis de pointertabel voor de plugins.
-  for (x = 0; x < PLUGIN_MAX; x++)
-  {
-    Plugin_ptr[x] = 0;
-    Plugin_id[x] = 0;
-    Plugin_State[x] = P_Enabled;
-  }
+#include PLUGINFILE(SKETCH_PATH, Plugin_254.c)
 
-  x = 0;
+/*********************************************************************************************\
+ * Receive plugins table, in flash and sorted by plugin id. Only enabled plugins are listed.
+ \*********************************************************************************************/
+#define PLUGIN_ENTRY(ID, NNN, FLAGS) {ID, &Plugin_##NNN, PLUGIN_##NNN##_MINPULSES, PLUGIN_##NNN##_MAXPULSES, FLAGS}
 
+const PluginDescriptor Plugin_table[] PROGMEM = {
 #ifdef PLUGIN_001
-  Plugin_id[x] = 1;
-  Plugin_ptr[x++] = &Plugin_001;
+    PLUGIN_ENTRY(1, 001, PLUGIN_F_TRANSLATE),
 #endif
-
 #ifdef PLUGIN_002
-  Plugin_id[x] = 2;
-  Plugin_ptr[x++] = &Plugin_002;
+    PLUGIN_ENTRY(2, 002, 0),
 #endif
-
 #ifdef PLUGIN_003
-  Plugin_id[x] = 3;
-  Plugin_ptr[x++] = &Plugin_003;
+    PLUGIN_ENTRY(3, 003, PLUGIN_F_ORDERED),
 #endif
-
 #ifdef PLUGIN_004
-  Plugin_id[x] = 4;
-  Plugin_ptr[x++] = &Plugin_004;
+    PLUGIN_ENTRY(4, 004, PLUGIN_F_ORDERED),
 #endif
-
 #ifdef PLUGIN_005
-  Plugin_id[x] = 5;
-  Plugin_ptr[x++] = &Plugin_005;
+    PLUGIN_ENTRY(5, 005, 0),
 #endif
-
 #ifdef PLUGIN_006
-  Plugin_id[x] = 6;
-  Plugin_ptr[x++] = &Plugin_006;
+    PLUGIN_ENTRY(6, 006, 0),
 #endif
-
 #ifdef PLUGIN_007
-  Plugin_id[x] = 7;
-  Plugin_ptr[x++] = &Plugin_007;
+    PLUGIN_ENTRY(7, 007, 0),
 #endif
-
 #ifdef PLUGIN_008
-  Plugin_id[x] = 8;
-  Plugin_ptr[x++] = &Plugin_008;
+    PLUGIN_ENTRY(8, 008, 0),
 #endif
-
 #ifdef PLUGIN_009
-  Plugin_id[x] = 9;
-  Plugin_ptr[x++] = &Plugin_009;
+    PLUGIN_ENTRY(9, 009, 0),
 #endif
-
 #ifdef PLUGIN_010
-  Plugin_id[x] = 10;
-  Plugin_ptr[x++] = &Plugin_010;
+    PLUGIN_ENTRY(10, 010, 0),
 #endif
-
 #ifdef PLUGIN_011
-  Plugin_id[x] = 11;
-  Plugin_ptr[x++] = &Plugin_011;
+    PLUGIN_ENTRY(11, 011, 0),
 #endif
-
 #ifdef PLUGIN_012
-  Plugin_id[x] = 12;
-  Plugin_ptr[x++] = &Plugin_012;
+    PLUGIN_ENTRY(12, 012, PLUGIN_F_ORDERED),
 #endif
-
 #ifdef PLUGIN_013
-  Plugin_id[x] = 13;
-  Plugin_ptr[x++] = &Plugin_013;
+    PLUGIN_ENTRY(13, 013, 0),
 #endif
-
 #ifdef PLUGIN_014
-  Plugin_id[x] = 14;
-  Plugin_ptr[x++] = &Plugin_014;
+    PLUGIN_ENTRY(14, 014, 0),
 #endif
-
 #ifdef PLUGIN_015
-  Plugin_id[x] = 15;
-  Plugin_ptr[x++] = &Plugin_015;
-#endif
-
-#ifdef PLUGIN_016
-  Plugin_id[x] = 16;
-  Plugin_ptr[x++] = &Plugin_016;
-#endif
-
-#ifdef PLUGIN_017
-  Plugin_id[x] = 17;
-  Plugin_ptr[x++] = &Plugin_017;
-#endif
-
-#ifdef PLUGIN_018
-  Plugin_id[x] = 18;
-  Plugin_ptr[x++] = &Plugin_018;
-#endif
-
-#ifdef PLUGIN_019
-  Plugin_id[x] = 19;
-  Plugin_ptr[x++] = &Plugin_019;
-#endif
-
-#ifdef PLUGIN_020
-  Plugin_id[x] = 20;
-  Plugin_ptr[x++] = &Plugin_020;
-#endif
-
-#ifdef PLUGIN_021
-  Plugin_id[x] = 21;
-  Plugin_ptr[x++] = &Plugin_021;
-#endif
-
-#ifdef PLUGIN_022
-  Plugin_id[x] = 22;
-  Plugin_ptr[x++] = &Plugin_022;
-#endif
-
-#ifdef PLUGIN_023
-  Plugin_id[x] = 23;
-  Plugin_ptr[x++] = &Plugin_023;
-#endif
-
-#ifdef PLUGIN_024
-  Plugin_id[x] = 24;
-  Plugin_ptr[x++] = &Plugin_024;
-#endif
-
-#ifdef PLUGIN_025
-  Plugin_id[x] = 25;
-  Plugin_ptr[x++] = &Plugin_025;
-#endif
-
-#ifdef PLUGIN_026
-  Plugin_id[x] = 26;
-  Plugin_ptr[x++] = &Plugin_026;
-#endif
-
-#ifdef PLUGIN_027
-  Plugin_id[x] = 27;
-  Plugin_ptr[x++] = &Plugin_027;
-#endif
-
-#ifdef PLUGIN_028
-  Plugin_id[x] = 28;
-  Plugin_ptr[x++] = &Plugin_028;
+    PLUGIN_ENTRY(15, 015, PLUGIN_F_ORDERED),
 #endif
-
 #ifdef PLUGIN_029
-  Plugin_id[x] = 29;
-  Plugin_ptr[x++] = &Plugin_029;
+    PLUGIN_ENTRY(29, 029, 0),
 #endif
-
 #ifdef PLUGIN_030
-  Plugin_id[x] = 30;
-  Plugin_ptr[x++] = &Plugin_030;
+    PLUGIN_ENTRY(30, 030, 0),
 #endif
-
 #ifdef PLUGIN_031
-  Plugin_id[x] = 31;
-  Plugin_ptr[x++] = &Plugin_031;
+    PLUGIN_ENTRY(31, 031, 0),
 #endif
-
 #ifdef PLUGIN_032
-  Plugin_id[x] = 32;
-  Plugin_ptr[x++] = &Plugin_032;
+    PLUGIN_ENTRY(32, 032, 0),
 #endif
-
 #ifdef PLUGIN_033
-  Plugin_id[x] = 33;
-  Plugin_ptr[x++] = &Plugin_033;
+    PLUGIN_ENTRY(33, 033, 0),
 #endif
-
 #ifdef PLUGIN_034
-  Plugin_id[x] = 34;
-  Plugin_ptr[x++] = &Plugin_034;
+    PLUGIN_ENTRY(34, 034, 0),
 #endif
-
 #ifdef PLUGIN_035
-  Plugin_id[x] = 35;
-  Plugin_ptr[x++] = &Plugin_035;
-#endif
-
-#ifdef PLUGIN_036
-  Plugin_id[x] = 36;
-  Plugin_ptr[x++] = &Plugin_036;
-#endif
-
-#ifdef PLUGIN_037
-  Plugin_id[x] = 37;
-  Plugin_ptr[x++] = &Plugin_037;
-#endif
-
-#ifdef PLUGIN_038
-  Plugin_id[x] = 38;
-  Plugin_ptr[x++] = &Plugin_038;
+    PLUGIN_ENTRY(35, 035, 0),
 #endif
-
-#ifdef PLUGIN_039
-  Plugin_id[x] = 39;
-  Plugin_ptr[x++] = &Plugin_039;
-#endif
-
 #ifdef PLUGIN_040
-  Plugin_id[x] = 40;
-  Plugin_ptr[x++] = &Plugin_040;
+    PLUGIN_ENTRY(40, 040, 0),
 #endif
-
 #ifdef PLUGIN_041
-  Plugin_id[x] = 41;
-  Plugin_ptr[x++] = &Plugin_041;
+    PLUGIN_ENTRY(41, 041, 0),
 #endif
-
 #ifdef PLUGIN_042
-  Plugin_id[x] = 42;
-  Plugin_ptr[x++] = &Plugin_042;
+    PLUGIN_ENTRY(42, 042, 0),
 #endif
-
 #ifdef PLUGIN_043
-  Plugin_id[x] = 43;
-  Plugin_ptr[x++] = &Plugin_043;
+    PLUGIN_ENTRY(43, 043, 0),
 #endif
-
 #ifdef PLUGIN_044
-  Plugin_id[x] = 44;
-  Plugin_ptr[x++] = &Plugin_044;
+    PLUGIN_ENTRY(44, 044, 0),
 #endif
-
 #ifdef PLUGIN_045
-  Plugin_id[x] = 45;
-  Plugin_ptr[x++] = &Plugin_045;
+    PLUGIN_ENTRY(45, 045, 0),
 #endif
-
 #ifdef PLUGIN_046
-  Plugin_id[x] = 46;
-  Plugin_ptr[x++] = &Plugin_046;
+    PLUGIN_ENTRY(46, 046, 0),
 #endif
-
 #ifdef PLUGIN_047
-  Plugin_id[x] = 47;
-  Plugin_ptr[x++] = &Plugin_047;
-#endif
-
-#ifdef PLUGIN_048
-  Plugin_id[x] = 48;
-  Plugin_ptr[x++] = &Plugin_048;
-#endif
-
-#ifdef PLUGIN_049
-  Plugin_id[x] = 49;
-  Plugin_ptr[x++] = &Plugin_049;
-#endif
-
-#ifdef PLUGIN_050
-  Plugin_id[x] = 50;
-  Plugin_ptr[x++] = &Plugin_050;
-#endif
-
-#ifdef PLUGIN_051
-  Plugin_id[x] = 51;
-  Plugin_ptr[x++] = &Plugin_051;
-#endif
-
-#ifdef PLUGIN_052
-  Plugin_id[x] = 52;
-  Plugin_ptr[x++] = &Plugin_052;
-#endif
-
-#ifdef PLUGIN_053
-  Plugin_id[x] = 53;
-  Plugin_ptr[x++] = &Plugin_053;
-#endif
-
-#ifdef PLUGIN_054
-  Plugin_id[x] = 54;
-  Plugin_ptr[x++] = &Plugin_054;
+    PLUGIN_ENTRY(47, 047, 0),
 #endif
-
-#ifdef PLUGIN_055
-  Plugin_id[x] = 55;
-  Plugin_ptr[x++] = &Plugin_055;
-#endif
-
-#ifdef PLUGIN_056
-  Plugin_id[x] = 56;
-  Plugin_ptr[x++] = &Plugin_056;
-#endif
-
-#ifdef PLUGIN_057
-  Plugin_id[x] = 57;
-  Plugin_ptr[x++] = &Plugin_057;
-#endif
-
-#ifdef PLUGIN_058
-  Plugin_id[x] = 58;
-  Plugin_ptr[x++] = &Plugin_058;
-#endif
-
-#ifdef PLUGIN_059
-  Plugin_id[x] = 59;
-  Plugin_ptr[x++] = &Plugin_059;
-#endif
-
 #ifdef PLUGIN_060
-  Plugin_id[x] = 60;
-  Plugin_ptr[x++] = &Plugin_060;
+    PLUGIN_ENTRY(60, 060, 0),
 #endif
-
 #ifdef PLUGIN_061
-  Plugin_id[x] = 61;
-  Plugin_ptr[x++] = &Plugin_061;
+    PLUGIN_ENTRY(61, 061, 0),
 #endif
-
 #ifdef PLUGIN_062
-  Plugin_id[x] = 62;
-  Plugin_ptr[x++] = &Plugin_062;
+    PLUGIN_ENTRY(62, 062, 0),
 #endif
-
 #ifdef PLUGIN_063
-  Plugin_id[x] = 63;
-  Plugin_ptr[x++] = &Plugin_063;
-#endif
-
-#ifdef PLUGIN_064
-  Plugin_id[x] = 64;
-  Plugin_ptr[x++] = &Plugin_064;
+    PLUGIN_ENTRY(63, 063, 0),
 #endif
-
-#ifdef PLUGIN_065
-  Plugin_id[x] = 65;
-  Plugin_ptr[x++] = &Plugin_065;
-#endif
-
-#ifdef PLUGIN_066
-  Plugin_id[x] = 66;
-  Plugin_ptr[x++] = &Plugin_066;
-#endif
-
-#ifdef PLUGIN_067
-  Plugin_id[x] = 67;
-  Plugin_ptr[x++] = &Plugin_067;
-#endif
-
-#ifdef PLUGIN_068
-  Plugin_id[x] = 68;
-  Plugin_ptr[x++] = &Plugin_068;
-#endif
-
-#ifdef PLUGIN_069
-  Plugin_id[x] = 69;
-  Plugin_ptr[x++] = &Plugin_069;
-#endif
-
 #ifdef PLUGIN_070
-  Plugin_id[x] = 70;
-  Plugin_ptr[x++] = &Plugin_070;
+    PLUGIN_ENTRY(70, 070, 0),
 #endif
-
 #ifdef PLUGIN_071
-  Plugin_id[x] = 71;
-  Plugin_ptr[x++] = &Plugin_071;
+    PLUGIN_ENTRY(71, 071, 0),
 #endif
-
 #ifdef PLUGIN_072
-  Plugin_id[x] = 72;
-  Plugin_ptr[x++] = &Plugin_072;
+    PLUGIN_ENTRY(72, 072, 0),
 #endif
-
 #ifdef PLUGIN_073
-  Plugin_id[x] = 73;
-  Plugin_ptr[x++] = &Plugin_073;
+    PLUGIN_ENTRY(73, 073, 0),
 #endif
-
 #ifdef PLUGIN_074
-  Plugin_id[x] = 74;
-  Plugin_ptr[x++] = &Plugin_074;
+    PLUGIN_ENTRY(74, 074, 0),
 #endif
-
 #ifdef PLUGIN_075
-  Plugin_id[x] = 75;
-  Plugin_ptr[x++] = &Plugin_075;
+    PLUGIN_ENTRY(75, 075, 0),
 #endif
-
-#ifdef PLUGIN_076
-  Plugin_id[x] = 76;
-  Plugin_ptr[x++] = &Plugin_076;
-#endif
-
-#ifdef PLUGIN_077
-  Plugin_id[x] = 77;
-  Plugin_ptr[x++] = &Plugin_077;
-#endif
-
-#ifdef PLUGIN_078
-  Plugin_id[x] = 78;
-  Plugin_ptr[x++] = &Plugin_078;
-#endif
-
-#ifdef PLUGIN_079
-  Plugin_id[x] = 79;
-  Plugin_ptr[x++] = &Plugin_079;
-#endif
-
 #ifdef PLUGIN_080
-  Plugin_id[x] = 80;
-  Plugin_ptr[x++] = &Plugin_080;
+    PLUGIN_ENTRY(80, 080, 0),
 #endif
-
 #ifdef PLUGIN_081
-  Plugin_id[x] = 81;
-  Plugin_ptr[x++] = &Plugin_081;
+    PLUGIN_ENTRY(81, 081, 0),
 #endif
-
 #ifdef PLUGIN_082
-  Plugin_id[x] = 82;
-  Plugin_ptr[x++] = &Plugin_082;
-#endif
-
-#ifdef PLUGIN_083
-  Plugin_id[x] = 83;
-  Plugin_ptr[x++] = &Plugin_083;
-#endif
-
-#ifdef PLUGIN_084
-  Plugin_id[x] = 84;
-  Plugin_ptr[x++] = &Plugin_084;
-#endif
-
-#ifdef PLUGIN_085
-  Plugin_id[x] = 85;
-  Plugin_ptr[x++] = &Plugin_085;
-#endif
-
-#ifdef PLUGIN_086
-  Plugin_id[x] = 86;
-  Plugin_ptr[x++] = &Plugin_086;
-#endif
-
-#ifdef PLUGIN_087
-  Plugin_id[x] = 87;
-  Plugin_ptr[x++] = &Plugin_087;
-#endif
-
-#ifdef PLUGIN_088
-  Plugin_id[x] = 88;
-  Plugin_ptr[x++] = &Plugin_088;
-#endif
-
-#ifdef PLUGIN_089
-  Plugin_id[x] = 89;
-  Plugin_ptr[x++] = &Plugin_089;
-#endif
-
-#ifdef PLUGIN_090
-  Plugin_id[x] = 90;
-  Plugin_ptr[x++] = &Plugin_090;
-#endif
-
-#ifdef PLUGIN_091
-  Plugin_id[x] = 91;
-  Plugin_ptr[x++] = &Plugin_091;
-#endif
-
-#ifdef PLUGIN_092
-  Plugin_id[x] = 92;
-  Plugin_ptr[x++] = &Plugin_092;
-#endif
-
-#ifdef PLUGIN_093
-  Plugin_id[x] = 93;
-  Plugin_ptr[x++] = &Plugin_093;
-#endif
-
-#ifdef PLUGIN_094
-  Plugin_id[x] = 94;
-  Plugin_ptr[x++] = &Plugin_094;
-#endif
-
-#ifdef PLUGIN_095
-  Plugin_id[x] = 95;
-  Plugin_ptr[x++] = &Plugin_095;
-#endif
-
-#ifdef PLUGIN_096
-  Plugin_id[x] = 96;
-  Plugin_ptr[x++] = &Plugin_096;
-#endif
-
-#ifdef PLUGIN_097
-  Plugin_id[x] = 97;
-  Plugin_ptr[x++] = &Plugin_097;
-#endif
-
-#ifdef PLUGIN_098
-  Plugin_id[x] = 98;
-  Plugin_ptr[x++] = &Plugin_098;
-#endif
-
-#ifdef PLUGIN_099
-  Plugin_id[x] = 99;
-  Plugin_ptr[x++] = &Plugin_099;
+    PLUGIN_ENTRY(82, 082, 0),
 #endif
-
-#ifdef PLUGIN_100
-  Plugin_id[x] = 100;
-  Plugin_ptr[x++] = &Plugin_100;
+#ifdef FLEX_DECODER
+    {FLEX_PLUGIN_ID, &Plugin_Flex, MIN_RAW_PULSES, RAW_BUFFER_SIZE, PLUGIN_F_FALLBACK},
 #endif
-
-#ifdef PLUGIN_101
-  Plugin_id[x] = 101;
-  Plugin_ptr[x++] = &Plugin_101;
+#ifdef PLUGIN_254
+    PLUGIN_ENTRY(254, 254, PLUGIN_F_FALLBACK),
 #endif
+};
 
-#ifdef PLUGIN_102
-  Plugin_id[x] = 102;
-  Plugin_ptr[x++] = &Plugin_102;
+const byte Plugin_count = sizeof(Plugin_table) / sizeof(Plugin_table[0]);
+byte Plugin_State[sizeof(Plugin_table) / sizeof(Plugin_table[0])];
+#ifdef PLUGIN_STATS
+PluginStatsStruct Plugin_stats[sizeof(Plugin_table) / sizeof(Plugin_table[0])];
+boolean PluginStatsRequest = false;
 #endif
-
-#ifdef PLUGIN_103
-  Plugin_id[x] = 103;
-  Plugin_ptr[x++] = &Plugin_103;
+#if defined(PLUGIN_DISPATCH_TABLE) && defined(PLUGIN_ADAPTIVE_ORDER)
+unsigned int Plugin_hits[sizeof(Plugin_table) / sizeof(Plugin_table[0])]; // recent decodes, halved every PLUGIN_ADAPTIVE_DECAY decodes
+unsigned int Plugin_hits_total = 0;
 #endif
 
-#ifdef PLUGIN_104
-  Plugin_id[x] = 104;
-  Plugin_ptr[x++] = &Plugin_104;
-#endif
+/*********************************************************************************************/
+void PluginInit(void)
+{
+  for (byte x = 0; x < Plugin_count; x++)
+    Plugin_State[x] = (Plugin_flags(x) & PLUGIN_F_TRANSLATE) ? P_Mandatory : P_Enabled;
 
-#ifdef PLUGIN_105
-  Plugin_id[x] = 105;
-  Plugin_ptr[x++] = &Plugin_105;
+#ifdef PLUGIN_STATE_EEPROM
+  PluginStateLoad();
 #endif
 
-#ifdef PLUGIN_106
-  Plugin_id[x] = 106;
-  Plugin_ptr[x++] = &Plugin_106;
+#ifdef FLEX_DECODER
+  FlexLoad();
 #endif
 
-#ifdef PLUGIN_107
-  Plugin_id[x] = 107;
-  Plugin_ptr[x++] = &Plugin_107;
+#ifdef PLUGIN_STATS
+  PluginStatsReset();
 #endif
 
-#ifdef PLUGIN_108
-  Plugin_id[x] = 108;
-  Plugin_ptr[x++] = &Plugin_108;
+#ifdef PLUGIN_DISPATCH_TABLE
+  PluginDispatchInit();
 #endif
 
-#ifdef PLUGIN_109
-  Plugin_id[x] = 109;
-  Plugin_ptr[x++] = &Plugin_109;
-#endif
+  // Initialiseer alle plugins door aanroep met verwerkingsparameter PLUGIN_INIT
+  PluginInitCall(0, 0);
+}
 
-#ifdef PLUGIN_110
-  Plugin_id[x] = 110;
-  Plugin_ptr[x++] = &Plugin_110;
-#endif
+/*********************************************************************************************\
+ * Runtime enable / disable of the receive plugins
+ \*********************************************************************************************/
+// Table index of plugin id, Plugin_count when the plugin is not compiled in
+byte PluginIndex(byte id)
+{
+  byte x;
 
-#ifdef PLUGIN_111
-  Plugin_id[x] = 111;
-  Plugin_ptr[x++] = &Plugin_111;
-#endif
+  for (x = 0; x < Plugin_count; x++)
+    if (Plugin_id(x) == id)
+      break;
+  return x;
+}
 
-#ifdef PLUGIN_112
-  Plugin_id[x] = 112;
-  Plugin_ptr[x++] = &Plugin_112;
-#endif
+byte PluginGetState(byte id)
+{
+  byte x = PluginIndex(id);
 
-#ifdef PLUGIN_113
-  Plugin_id[x] = 113;
-  Plugin_ptr[x++] = &Plugin_113;
-#endif
+  if (x >= Plugin_count)
+    return P_Forbidden;
+  return Plugin_State[x];
+}
 
-#ifdef PLUGIN_114
-  Plugin_id[x] = 114;
-  Plugin_ptr[x++] = &Plugin_114;
-#endif
+// State is P_Enabled or P_Disabled, mandatory plugins stay enabled. False when plugin id is not compiled in.
+boolean PluginSetState(byte id, byte State)
+{
+  byte x = PluginIndex(id);
 
-#ifdef PLUGIN_115
-  Plugin_id[x] = 115;
-  Plugin_ptr[x++] = &Plugin_115;
-#endif
+  if (x >= Plugin_count)
+    return false;
+  if ((Plugin_State[x] == P_Mandatory) || (Plugin_State[x] == State))
+    return true;
 
-#ifdef PLUGIN_116
-  Plugin_id[x] = 116;
-  Plugin_ptr[x++] = &Plugin_116;
+  Plugin_State[x] = State;
+#ifdef PLUGIN_STATE_EEPROM
+  PluginStateSave();
 #endif
+  return true;
+}
 
-#ifdef PLUGIN_117
-  Plugin_id[x] = 117;
-  Plugin_ptr[x++] = &Plugin_117;
-#endif
+#ifdef PLUGIN_STATE_EEPROM
+// EEPROM holds PLUGIN_EEPROM_MAGIC, then one "disabled" bit per plugin id (not per table index,
+// so that the mask survives a change of the compiled plugins)
+#define PLUGIN_EEPROM_MAGIC 0x52
+#define PLUGIN_EEPROM_SIZE (1 + 256 / 8)
 
-#ifdef PLUGIN_118
-  Plugin_id[x] = 118;
-  Plugin_ptr[x++] = &Plugin_118;
-#endif
+void PluginStateLoad(void)
+{
+  byte id;
 
-#ifdef PLUGIN_119
-  Plugin_id[x] = 119;
-  Plugin_ptr[x++] = &Plugin_119;
-#endif
+  if (EEPROM.read(PLUGIN_EEPROM_ADDR) != PLUGIN_EEPROM_MAGIC)
+    return; // never saved, keep defaults
 
-#ifdef PLUGIN_120
-  Plugin_id[x] = 120;
-  Plugin_ptr[x++] = &Plugin_120;
-#endif
+  for (byte x = 0; x < Plugin_count; x++)
+  {
+    id = Plugin_id(x);
+    if ((Plugin_State[x] != P_Mandatory) && (EEPROM.read(PLUGIN_EEPROM_ADDR + 1 + (id >> 3)) & (1 << (id & 7))))
+      Plugin_State[x] = P_Disabled;
+  }
+}
 
-#ifdef PLUGIN_250
-  Plugin_id[x] = 250;
-  Plugin_ptr[x++] = &Plugin_250;
-#endif
+void PluginStateSave(void)
+{
+  byte mask[PLUGIN_EEPROM_SIZE - 1];
+  byte id;
+  boolean Changed;
 
-#ifdef PLUGIN_251
-  Plugin_id[x] = 251;
-  Plugin_ptr[x++] = &Plugin_251;
-#endif
+  for (byte i = 0; i < sizeof(mask); i++)
+    mask[i] = 0;
+  for (byte x = 0; x < Plugin_count; x++)
+  {
+    id = Plugin_id(x);
+    if (Plugin_State[x] < P_Enabled)
+      mask[id >> 3] |= (1 << (id & 7));
+  }
 
-#ifdef PLUGIN_252
-  Plugin_id[x] = 252;
-  Plugin_ptr[x++] = &Plugin_252;
+  Changed = EepromUpdate(PLUGIN_EEPROM_ADDR, PLUGIN_EEPROM_MAGIC);
+  for (byte i = 0; i < sizeof(mask); i++)
+    Changed |= EepromUpdate(PLUGIN_EEPROM_ADDR + 1 + i, mask[i]);
+#if (defined(ESP32) || defined(ESP8266))
+  if (Changed)
+    EEPROM.commit(); // rewrites the whole flash sector
 #endif
+}
+#endif // PLUGIN_STATE_EEPROM
 
-#ifdef PLUGIN_253
-  Plugin_id[x] = 253;
-  Plugin_ptr[x++] = &Plugin_253;
-#endif
+#ifdef PLUGIN_DISPATCH_TABLE
+/*********************************************************************************************\
+ * Build the pulse count => candidate plugins table
+ \*********************************************************************************************/
+void PluginDispatchInit(void)
+{
+  unsigned int n;
+  unsigned int total = 0;
 
-#ifdef PLUGIN_254
-  Plugin_id[x] = 254;
-  Plugin_ptr[x++] = &Plugin_254;
-#endif
+  for (n = 0; n <= RAW_BUFFER_SIZE; n++)
+  {
+    Dispatch_first[n] = total;
+    for (byte x = 0; x < Plugin_count; x++)
+    {
+      if ((n >= Plugin_minpulses(x)) && (n <= Plugin_maxpulses(x)))
+      {
+        if (total < PLUGIN_DISPATCH_SIZE)
+          Dispatch_list[total] = x;
+        total++;
+      }
+    }
+  }
+  Dispatch_first[RAW_BUFFER_SIZE + 1] = total;
+  Dispatch_ready = (total <= PLUGIN_DISPATCH_SIZE); // else fall back to full scan
 
-#ifdef PLUGIN_255
-  Plugin_id[x] = 255;
-  Plugin_ptr[x++] = &Plugin_255;
+#ifdef PLUGIN_ADAPTIVE_ORDER
+  for (byte x = 0; x < Plugin_count; x++)
+    Plugin_hits[x] = 0;
+  Plugin_hits_total = 0;
 #endif
-
-  // Initialiseer alle plugins door aanroep met verwerkingsparameter PLUGIN_INIT
-  PluginInitCall(0, 0);
 }
+#endif
 /*********************************************************************************************/
 /*
   void PluginTXInit(void)
@@ -1628,15 +831,9 @@ void PluginInit(void)
  \*********************************************************************************************/
 byte PluginInitCall(byte Function, char *str)
 {
-  int x;
+  for (byte x = 0; x < Plugin_count; x++)
+    Plugin_ptr(x)(Function, str);
 
-  for (x = 0; x < PLUGIN_MAX; x++)
-  {
-    if (Plugin_id[x] != 0)
-    {
-      Plugin_ptr[x](Function, str);
-    }
-  }
   return true;
 }
 /*********************************************************************************************\
@@ -1654,25 +851,176 @@ byte PluginTXInitCall(byte Function, char *str) {
   return true;
 }
 */
+/*********************************************************************************************\
+ * Call receive plugin x, keeping its statistics
+ \*********************************************************************************************/
+static inline boolean PluginCall(byte x, byte Function, char *str)
+{
+#ifdef PLUGIN_STATS
+  unsigned long Start = RF_CYCLES();
+  boolean Accepted = Plugin_ptr(x)(Function, str);
+
+  Plugin_stats[x].cycles += RF_CYCLES() - Start;
+  Plugin_stats[x].calls++;
+  if (Accepted)
+    Plugin_stats[x].accepts++;
+  return Accepted;
+#else
+  return Plugin_ptr(x)(Function, str);
+#endif
+}
+#if defined(PLUGIN_DISPATCH_TABLE) && defined(PLUGIN_ADAPTIVE_ORDER)
+/*********************************************************************************************\
+ * Move the plugin that just decoded Dispatch_list[p] ahead of the plugins of its list that
+ * decoded less frames recently. Plugin_001 stays first, Plugin_254 last, and the
+ * PLUGIN_F_ORDERED plugins never pass each other.
+ \*********************************************************************************************/
+static void PluginPromote(unsigned int first, unsigned int p)
+{
+  byte x = Dispatch_list[p];
+  byte prev;
+
+  if (Plugin_hits[x] < 0xFFFF)
+    Plugin_hits[x]++;
+  if (++Plugin_hits_total >= PLUGIN_ADAPTIVE_DECAY)
+  { // forget the past slowly, so that the order follows the neighbourhood
+    for (byte y = 0; y < Plugin_count; y++)
+      Plugin_hits[y] >>= 1;
+    Plugin_hits_total = 0;
+  }
+
+  if (Plugin_flags(x) & PLUGIN_F_FALLBACK)
+    return;
+
+  while (p > first)
+  {
+    prev = Dispatch_list[p - 1];
+    if (Plugin_hits[prev] >= Plugin_hits[x])
+      break;
+    if (Plugin_flags(prev) & PLUGIN_F_TRANSLATE)
+      break;
+    if (Plugin_flags(prev) & Plugin_flags(x) & PLUGIN_F_ORDERED)
+      break;
+    Dispatch_list[p - 1] = x;
+    Dispatch_list[p] = prev;
+    p--;
+  }
+}
+#endif
 /*********************************************************************************************\
  * With this function plugins are called that have Receive functionality. 
  \*********************************************************************************************/
 byte PluginRXCall(byte Function, char *str)
 {
-  for (byte x = 0; x < PLUGIN_MAX; x++)
+  if ((RawSignal.Number < 0) || (RawSignal.Number > RAW_BUFFER_SIZE))
+    return false;
+
+  RawSignalRescale();
+  PulseFeaturesCompute();
+#ifdef SIGNAL_MEMO
+  unsigned long Fingerprint = PulseFingerprint(); // before any translation by Plugin_001
+  if (SignalMemoCheck(Fingerprint))
+    return true; // repeat of a frame just decoded, its plugin would drop it
+#endif
+
+#ifdef PLUGIN_DISPATCH_TABLE
+  if (Dispatch_ready)
+  { // Only offer the frame to the plugins that accept its length
+    int Number = RawSignal.Number;
+    unsigned int first = Dispatch_first[Number];
+    unsigned int last = Dispatch_first[Number + 1];
+    unsigned int i = first;
+    byte x;
+
+    while (i < last)
+    {
+      x = Dispatch_list[i++];
+      if (Plugin_State[x] >= P_Enabled)
+      {
+        SignalHash = x; // store plugin number
+        if (PluginCall(x, Function, str))
+        {
+          Event.Protocol = Plugin_id(x);
+          SignalDecoded(Plugin_id(x));
+#ifdef PLUGIN_ADAPTIVE_ORDER
+          PluginPromote(first, i - 1);
+#endif
+#ifdef SIGNAL_MEMO
+          SignalMemoStore(Fingerprint);
+#endif
+          return true;
+        }
+        if (RawSignal.Number != Number)
+        { // Packet has been translated (Plugin_001), go on after this plugin with the plugins accepting the new length
+          Number = RawSignal.Number;
+          if ((Number < 0) || (Number > RAW_BUFFER_SIZE))
+            return false;
+          PulseFeaturesCompute();
+          first = Dispatch_first[Number];
+          last = Dispatch_first[Number + 1];
+          i = first;
+          while (i < last)
+            if (Dispatch_list[i++] == x)
+              break;
+        }
+      }
+    }
+    return false;
+  }
+#endif
+
+  for (byte x = 0; x < Plugin_count; x++)
   {
-    if ((Plugin_id[x] != 0) && (Plugin_State[x] >= P_Enabled))
+    if ((Plugin_State[x] >= P_Enabled) &&
+        (RawSignal.Number >= (int)Plugin_minpulses(x)) && (RawSignal.Number <= (int)Plugin_maxpulses(x)))
     {
       SignalHash = x; // store plugin number
-      if (Plugin_ptr[x](Function, str))
+      if (PluginCall(x, Function, str))
       {
-        SignalHashPrevious = SignalHash; // store previous plugin number after success
+        Event.Protocol = Plugin_id(x);
+        SignalDecoded(Plugin_id(x));
+#ifdef SIGNAL_MEMO
+        SignalMemoStore(Fingerprint);
+#endif
         return true;
       }
+      if (RawSignal.Number != RawFeatures.Number)
+      { // Packet has been translated (Plugin_001)
+        if ((RawSignal.Number < 0) || (RawSignal.Number > RAW_BUFFER_SIZE))
+          return false;
+        PulseFeaturesCompute();
+      }
     }
   }
   return false;
 }
+#ifdef PLUGIN_STATS
+/*********************************************************************************************\
+ * Plugin statistics
+ \*********************************************************************************************/
+void PluginStatsReset(void)
+{
+  for (byte x = 0; x < Plugin_count; x++)
+  {
+    Plugin_stats[x].calls = 0;
+    Plugin_stats[x].accepts = 0;
+    Plugin_stats[x].cycles = 0;
+  }
+}
+
+// Put the statistics of plugin x in Event, false if the plugin was not called
+boolean PluginStatsMsg(byte x)
+{
+  if (Plugin_stats[x].calls == 0)
+    return false;
+
+  display_Header();
+  display_Name(PSTR("STATS"));
+  display_STATS(Plugin_id(x), Plugin_stats[x].calls, Plugin_stats[x].accepts, (unsigned long)(Plugin_stats[x].cycles / 1000));
+  display_Footer();
+  return true;
+}
+#endif
 /*********************************************************************************************\
  * With this function plugins are called that have Transmit functionality. 
  \*********************************************************************************************/
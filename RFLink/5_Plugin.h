@@ -10,11 +10,45 @@
 
 #include <Arduino.h>
 
-extern boolean (*Plugin_ptr[PLUGIN_MAX])(byte, char *); // Receive plugins
-extern byte Plugin_id[PLUGIN_MAX];
+// Receive plugin descriptor, see Plugin_table[] in 5_Plugin.cpp
+struct PluginDescriptor
+{
+  byte id;
+  boolean (*ptr)(byte, char *);
+  uint16_t minpulses; // shortest RawSignal.Number the plugin can decode (PLUGIN_xxx_MINPULSES)
+  uint16_t maxpulses; // longest RawSignal.Number the plugin can decode (PLUGIN_xxx_MAXPULSES)
+  byte flags;
+};
+
+#define PLUGIN_F_TRANSLATE 0x01 // may rewrite RawSignal for the plugins after it (Plugin_001), must run first
+#define PLUGIN_F_FALLBACK 0x02  // gets what the other plugins left (flex decoders, Plugin_254), must run last, never promoted
+#define PLUGIN_F_ORDERED 0x04   // decodes frames of another ordered plugin (Kaku/NewKaku/FA500/HomeEasy), keep compile order between them
+
+extern const PluginDescriptor Plugin_table[]; // in PROGMEM
+extern const byte Plugin_count;
+
+inline byte Plugin_id(byte x) { return pgm_read_byte(&Plugin_table[x].id); }
+inline boolean (*Plugin_ptr(byte x))(byte, char *) { return (boolean(*)(byte, char *))pgm_read_ptr(&Plugin_table[x].ptr); }
+inline uint16_t Plugin_minpulses(byte x) { return pgm_read_word(&Plugin_table[x].minpulses); }
+inline uint16_t Plugin_maxpulses(byte x) { return pgm_read_word(&Plugin_table[x].maxpulses); }
+inline byte Plugin_flags(byte x) { return pgm_read_byte(&Plugin_table[x].flags); }
 
 enum PState {P_Forbidden, P_Disabled, P_Enabled, P_Mandatory}; 
-extern byte Plugin_State[PLUGIN_MAX];
+extern byte Plugin_State[]; // Plugin_count entries
+
+#ifdef PLUGIN_STATS
+struct PluginStatsStruct
+{
+  unsigned long calls;       // frames offered to the plugin
+  unsigned long accepts;     // frames decoded by the plugin, the others were rejected
+  unsigned long long cycles; // RF_CYCLES() spent in the plugin
+};
+extern PluginStatsStruct Plugin_stats[]; // Plugin_count entries
+extern boolean PluginStatsRequest;       // 10;STATS; asks for the report now instead of after PLUGIN_STATS_MS
+
+void PluginStatsReset(void);
+boolean PluginStatsMsg(byte x);
+#endif
 
 extern boolean RFDebug;   // debug RF signals with plugin 001 (no decode)
 extern boolean QRFDebug;  // debug RF signals with plugin 001 but no multiplication (faster?, compact)
@@ -22,7 +56,6 @@ extern boolean RFUDebug;  // debug RF signals with plugin 254 (decode 1st)
 extern boolean QRFUDebug; // debug RF signals with plugin 254 but no multiplication (faster?, compact)
 
 // void(*Reboot)(void) = 0;
-// boolean (*Plugin_ptr[PLUGIN_MAX])(byte, char*);
 
 // Of all the devices that are compiled, the addresses are stored in a table so that you can jump to them
 void PluginInit(void);
@@ -30,6 +63,16 @@ void PluginInit(void);
 byte PluginInitCall(byte Function, char *str);
 // byte PluginTXInitCall(byte Function, char *str);
 byte PluginRXCall(byte Function, char *str);
+byte PluginIndex(byte id);
+byte PluginGetState(byte id);
+boolean PluginSetState(byte id, byte State);
+#ifdef PLUGIN_STATE_EEPROM
+void PluginStateLoad(void);
+void PluginStateSave(void);
+#endif
+#ifdef PLUGIN_DISPATCH_TABLE
+void PluginDispatchInit(void);
+#endif
 // byte PluginTXCall(byte Function, char *str);
 
 #endif
\ No newline at end of file
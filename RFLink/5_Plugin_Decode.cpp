@@ -0,0 +1,218 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#include <Arduino.h>
+#include "RFLink.h"
+#include "2_Signal.h"
+#include "5_Plugin_Decode.h"
+
+/*********************************************************************************************\
+ * Generic PWM / OOK decoder
+ * The per bit checks are turned into two [low, high] windows indexed by the bit value,
+ * so that the loop has no protocol specific branch.
+ \*********************************************************************************************/
+static inline __attribute__((always_inline)) boolean PulseCodeRun(const PulseCodeStruct &Code, unsigned long *Bits)
+{
+  byte DataLow[2], DataHigh[2];   // valid data pulse, [short] and [long]
+  byte OtherLow[2], OtherHigh[2]; // valid other pulse, [short] and [long]
+  byte LongFrom;
+  byte Invert;
+  byte Pulse, OtherPulse;
+  byte Long;
+  unsigned long Word = 0;
+  int x;
+
+  x = Code.First + (int)(Code.Bits - 1) * Code.Step; // last data pulse
+  if ((Code.First + Code.Other < 1) || (x + ((Code.Other > 0) ? Code.Other : 0) > RawSignal.Number))
+    return false;
+
+  LongFrom = (Code.Flags & PULSECODE_MID_IS_LONG) ? Code.Mid : Code.Mid + 1;
+  Invert = (Code.Flags & PULSECODE_LONG_IS_0) ? 1 : 0;
+
+  if ((Code.ShortMin == 0) && (Code.ShortMax >= LongFrom - 1) && (Code.LongMax == 0xFF) &&
+      ((Code.Other == 0) || ((Code.OtherMax == 0xFF) && !(Code.Flags & PULSECODE_OPPOSITE))) && (LongFrom > 0))
+  { // no pulse can be out of range: the bits are the short/long map, 32 at a time
+    const uint32_t *Map = PulseQuantize(LongFrom - 1);
+    Bits[0] = PulseMapBits(Map, Code.First, (Code.Bits > 32) ? 32 : Code.Bits, Code.Step);
+    Bits[1] = (Code.Bits > 32) ? PulseMapBits(Map, Code.First + 32 * Code.Step, Code.Bits - 32, Code.Step) : 0;
+    if (Invert)
+    {
+      Bits[0] ^= (Code.Bits >= 32) ? 0xFFFFFFFFUL : ((1UL << Code.Bits) - 1);
+      Bits[1] ^= (Code.Bits > 32) ? ((Code.Bits == 64) ? 0xFFFFFFFFUL : ((1UL << (Code.Bits - 32)) - 1)) : 0;
+    }
+    return true;
+  }
+  DataLow[0] = Code.ShortMin;
+  DataHigh[0] = Code.ShortMax;
+  DataLow[1] = LongFrom;
+  DataHigh[1] = Code.LongMax;
+  OtherLow[0] = OtherLow[1] = 0;
+  OtherHigh[0] = OtherHigh[1] = (Code.Other != 0) ? Code.OtherMax : 0xFF;
+  if (Code.Flags & PULSECODE_OPPOSITE)
+  {
+    OtherLow[0] = Code.Mid; // short data, other is at least Mid
+    if (OtherHigh[1] > Code.Mid)
+      OtherHigh[1] = Code.Mid; // long data, other is at most Mid
+  }
+
+  Bits[0] = Bits[1] = 0;
+  x = Code.First;
+  for (byte i = 0; i < Code.Bits; i++, x += Code.Step)
+  {
+    Pulse = RawSignal.Pulses[x];
+    OtherPulse = RawSignal.Pulses[x + Code.Other];
+    Long = (Pulse >= LongFrom);
+
+    if ((Pulse < DataLow[Long]) | (Pulse > DataHigh[Long]) | (OtherPulse < OtherLow[Long]) | (OtherPulse > OtherHigh[Long]))
+      return false;
+
+    Word = (Word << 1) | (Long ^ Invert);
+    Bits[i >> 5] = Word; // bits 0..31 go to Bits[0], the next ones to Bits[1]
+    if ((i & 31) == 31)
+      Word = 0;
+  }
+  return true;
+}
+
+boolean PulseCodeDecode(const PulseCodeStruct *CodeP, unsigned long *Bits)
+{
+  PulseCodeStruct Code;
+
+  memcpy_P(&Code, CodeP, sizeof(Code));
+  return PulseCodeRun(Code, Bits);
+}
+
+boolean PulseCodeDecodeRAM(const PulseCodeStruct *Code, unsigned long *Bits)
+{
+  return PulseCodeRun(*Code, Bits);
+}
+
+/*********************************************************************************************\
+ * Half bit decoder
+ * BIPHASE: both short pulses of a 0 bit are read at once, a lone short pulse followed
+ *          by a long one is a coding error.
+ * DIFF   : a short pulse following a bit is the second half of that bit.
+ \*********************************************************************************************/
+static inline __attribute__((always_inline)) int PulseHalfLoop(int First, int Last, byte Mid, byte End, const byte Flags, byte *Data, int MaxBits)
+{
+  const boolean Diff = (Flags & PULSEHALF_DIFF);
+  const boolean UseParity = (Flags & PULSEHALF_PARITY);
+  byte Bit = 1;    // current bit value
+  byte Parity = 0; // parity of the current byte
+  byte Acc = 0;    // current byte
+  byte Need = 8;   // bits missing in the current byte, 0 when its parity bit is due
+  int Count = 0;   // data bits written into Data
+  int Checked = 0; // data bits whose parity bit was checked
+  byte Pulse;
+
+  for (int x = First; x <= Last; x++)
+  {
+    Pulse = RawSignal.Pulses[x];
+    if (Pulse > End)
+      break;
+
+    if (Diff)
+    {
+      Bit ^= (Pulse > Mid);
+      x += (RawSignal.Pulses[x + 1] <= Mid); // second half of the bit
+    }
+    else if (Pulse > Mid)
+      Bit = 1;
+    else
+    {
+      if (x == Last)
+        break; // single short pulse at the end
+      if (RawSignal.Pulses[++x] > Mid)
+        return -1; // a 1 bit can not follow a single short pulse
+      Bit = 0;
+    }
+
+    if (Need == 0)
+    { // parity bit
+      if (Bit != Parity)
+        return -1;
+      Parity = 0;
+      Need = 8;
+      Checked = Count;
+      if (Count >= MaxBits)
+        break;
+      continue;
+    }
+
+    Acc = (Acc << 1) | Bit;
+    Parity ^= Bit;
+    Count++;
+    if (--Need == 0)
+    {
+      Data[(Count - 1) >> 3] = Acc;
+      Acc = 0;
+      if (!UseParity)
+        Need = 8;
+    }
+    if ((Count >= MaxBits) && !UseParity)
+      break;
+  }
+  if ((Need != 0) && (Need != 8))
+    Data[Count >> 3] = Acc << Need; // last partial byte, left aligned
+
+  return UseParity ? Checked : Count;
+}
+
+// one copy of the loop per mode, so that the flags are not tested for every pulse
+int PulseHalfDecode(int First, int Last, byte Mid, byte End, byte Flags, byte *Data, int MaxBits)
+{
+  switch (Flags & (PULSEHALF_DIFF | PULSEHALF_PARITY))
+  {
+  case PULSEHALF_BIPHASE:
+    return PulseHalfLoop(First, Last, Mid, End, PULSEHALF_BIPHASE, Data, MaxBits);
+  case PULSEHALF_BIPHASE | PULSEHALF_PARITY:
+    return PulseHalfLoop(First, Last, Mid, End, PULSEHALF_BIPHASE | PULSEHALF_PARITY, Data, MaxBits);
+  case PULSEHALF_DIFF:
+    return PulseHalfLoop(First, Last, Mid, End, PULSEHALF_DIFF, Data, MaxBits);
+  default:
+    return PulseHalfLoop(First, Last, Mid, End, PULSEHALF_DIFF | PULSEHALF_PARITY, Data, MaxBits);
+  }
+}
+
+/*********************************************************************************************\
+ * Tristate decoder
+ * Constant time per symbol: four compares, one table lookup.
+ \*********************************************************************************************/
+const byte Tristate_table[16] PROGMEM = {
+    TRISTATE_ERROR,  // 0000
+    TRISTATE_ERROR,  // 0001
+    TRISTATE_ERROR,  // 0010
+    TRISTATE_ERROR,  // 0011
+    TRISTATE_SHORT0, // 0100
+    TRISTATE_0,      // 0101
+    TRISTATE_F,      // 0110
+    TRISTATE_ERROR,  // 0111
+    TRISTATE_ERROR,  // 1000
+    TRISTATE_ERROR,  // 1001
+    TRISTATE_1,      // 1010
+    TRISTATE_ERROR,  // 1011
+    TRISTATE_ERROR,  // 1100
+    TRISTATE_0D,     // 1101
+    TRISTATE_ERROR,  // 1110
+    TRISTATE_ERROR}; // 1111
+
+byte TristateDecode(int First, byte Count, byte Mid, byte *Symbols)
+{
+  const byte *Pulse = RawSignal.Pulses + First;
+  byte Pattern, Equal, Symbol;
+  byte Seen = 0;
+
+  for (byte i = 0; i < Count; i++, Pulse += 4)
+  {
+    Pattern = ((Pulse[0] > Mid) << 3) | ((Pulse[1] > Mid) << 2) | ((Pulse[2] > Mid) << 1) | (Pulse[3] > Mid);
+    Equal = (Pulse[0] == Mid) | (Pulse[1] == Mid) | (Pulse[2] == Mid) | (Pulse[3] == Mid);
+    Symbol = Equal ? TRISTATE_ERROR : pgm_read_byte(&Tristate_table[Pattern]);
+    Symbols[i] = Symbol;
+    Seen |= (1 << Symbol);
+  }
+  return Seen;
+}
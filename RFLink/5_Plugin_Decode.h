@@ -0,0 +1,72 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef Plugin_Decode_h
+#define Plugin_Decode_h
+
+#include <Arduino.h>
+#include "RFLink.h"
+
+// ***********************************************************************************
+// Generic PWM / OOK bit decoder. One bit every Step pulses, the bit value is the length
+// (short or long) of the data pulse. The other pulse of the bit may be checked too.
+// Descriptors live in PROGMEM, all lengths are in samples (uSec / RAWSIGNAL_SAMPLE_RATE).
+// ***********************************************************************************
+#define PULSECODE_LONG_IS_0 0x01   // long data pulse is a 0 bit (default: long is 1)
+#define PULSECODE_MID_IS_LONG 0x02 // data pulse equal to Mid is long (default: short)
+#define PULSECODE_OPPOSITE 0x04    // other pulse must be on the other side of Mid: long/short or short/long
+
+struct PulseCodeStruct
+{
+  byte First;    // position in Pulses[] of the first data pulse
+  byte Bits;     // number of bits, up to 64
+  byte Step;     // pulses per bit
+  byte Mid;      // data pulses longer than Mid are long
+  byte ShortMin; // shortest valid short data pulse
+  byte ShortMax; // longest valid short data pulse (Mid when there is no dead zone)
+  byte LongMax;  // longest valid long data pulse (0xFF when not checked)
+  int8_t Other;  // position of the other pulse, relative to the data pulse (0 when not checked)
+  byte OtherMax; // longest valid other pulse (0xFF when not checked)
+  byte Flags;    // PULSECODE_xxx
+};
+
+// Decode RawSignal with Code (PROGMEM). Bits[0] gets the first 32 bits, Bits[1] the next ones,
+// both MSB first and right aligned. False when a pulse does not fit the code.
+boolean PulseCodeDecode(const PulseCodeStruct *Code, unsigned long *Bits);
+boolean PulseCodeDecodeRAM(const PulseCodeStruct *Code, unsigned long *Bits); // same, Code built at runtime
+
+// ***********************************************************************************
+// Half bit decoder for biphase / Manchester codes. Short pulses are half a bit period,
+// long pulses a whole one, so one threshold at 1.5 half bits tolerates a lot of drift.
+// ***********************************************************************************
+#define PULSEHALF_BIPHASE 0x00 // a long pulse is a 1, two short pulses are a 0 (Cresta / Hideki)
+#define PULSEHALF_DIFF 0x01    // a long pulse toggles the bit, a short one keeps it (Oregon), starts from a 1
+#define PULSEHALF_PARITY 0x02  // every 8 data bits are followed by an even parity bit, checked and dropped
+
+// Decode Pulses[First..Last], pulses longer than Mid are long, a pulse longer than End stops decoding.
+// Data is filled MSB first, up to MaxBits data bits, the bytes after the last bit are left untouched.
+// Returns the number of data bits (whole checked bytes with PULSEHALF_PARITY), or -1 on a coding error.
+int PulseHalfDecode(int First, int Last, byte Mid, byte End, byte Flags, byte *Data, int MaxBits);
+
+// ***********************************************************************************
+// Tristate (PT2262 / EV1527) symbol decoder. Each group of four pulses is packed into a
+// 4 bit short (0) / long (1) pattern, first pulse first, and looked up in Tristate_table.
+// ***********************************************************************************
+#define TRISTATE_0 0      // 0101
+#define TRISTATE_F 1      // 0110
+#define TRISTATE_1 2      // 1010
+#define TRISTATE_ERROR 3  // any other pattern, or a pulse equal to Mid
+#define TRISTATE_SHORT0 4 // 0100, short 0
+#define TRISTATE_0D 5     // 1101, 0 with a stretched first pulse, sometimes seen on the first symbol
+
+extern const byte Tristate_table[16] PROGMEM;
+
+// Decode Count symbols starting at Pulses[First], pulses longer than Mid are long.
+// Returns the symbols found, one bit per symbol (1 << TRISTATE_x).
+byte TristateDecode(int First, byte Count, byte Mid, byte *Symbols);
+
+#endif // Plugin_Decode_h
@@ -0,0 +1,465 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#include <Arduino.h>
+#include "RFLink.h"
+#include "2_Signal.h"
+#include "4_Display.h"
+#include "5_Plugin_Decode.h"
+#include "5_Plugin_Flex.h"
+#include "7_Utils.h"
+
+#ifdef FLEX_DECODER
+#include <EEPROM.h>
+
+#define FLEX_OFF 0
+#define FLEX_PWM 1
+#define FLEX_PPM 2
+#define FLEX_MAN 3
+#define FLEX_MODE 0x0F   // mode bits of FlexStruct.Mode
+#define FLEX_LSB 0x10    // LSB first in each byte
+#define FLEX_INVERT 0x20 // inverted bits
+
+#define FLEX_CHECK_NONE 0
+#define FLEX_CHECK_XOR 1
+#define FLEX_CHECK_ADD 2
+#define FLEX_CHECK_PAR 3
+#define FLEX_CHECK_CRC8 4
+
+#define FLEX_NONE 0xFF // no id / value bits
+#define FLEX_EEPROM_MAGIC 0x46
+
+struct FlexStruct // 16 bytes, kept as is in EEPROM
+{
+  byte Mode;           // FLEX_OFF, FLEX_PWM, FLEX_PPM or FLEX_MAN, plus FLEX_LSB / FLEX_INVERT
+  byte First;          // position in Pulses[] of the first pulse of the first bit
+  uint16_t MinPulses;  // RawSignal.Number range
+  uint16_t MaxPulses;  //
+  byte Short;          // short pulse (half bit for FLEX_MAN) in samples, 0 = from RawFeatures
+  byte Long;           // long pulse in samples
+  byte Bits;           // 1..64
+  byte IdFirst;        // id bit range, FLEX_NONE when there is none
+  byte IdLast;         //
+  byte ValueFirst;     // value bit range, FLEX_NONE when there is none
+  byte ValueLast;      //
+  byte Check;          // FLEX_CHECK_xxx
+  byte Poly;           // FLEX_CHECK_CRC8 polynomial
+};
+
+FlexStruct Flex[FLEX_SLOTS];
+
+/*********************************************************************************************\
+ * Storage
+ \*********************************************************************************************/
+// Same limits as FlexParse(), for the slots read from EEPROM
+static boolean FlexValid(const FlexStruct *Def)
+{
+  if (((Def->Mode & FLEX_MODE) < FLEX_PWM) || ((Def->Mode & FLEX_MODE) > FLEX_MAN) ||
+      (Def->Mode & ~(FLEX_MODE | FLEX_LSB | FLEX_INVERT)))
+    return false;
+  if ((Def->MinPulses > Def->MaxPulses) || (Def->MaxPulses > RAW_BUFFER_SIZE))
+    return false;
+  if (((Def->Short == 0) != (Def->Long == 0)) || ((Def->Short != 0) && (Def->Short >= Def->Long)))
+    return false;
+  if ((Def->Bits == 0) || (Def->Bits > 64))
+    return false;
+  if ((Def->IdFirst != FLEX_NONE) && ((Def->IdLast < Def->IdFirst) || (Def->IdLast >= Def->Bits) || (Def->IdLast - Def->IdFirst > 31)))
+    return false;
+  if ((Def->IdFirst == FLEX_NONE) != (Def->IdLast == FLEX_NONE))
+    return false;
+  if ((Def->ValueFirst != FLEX_NONE) && ((Def->ValueLast < Def->ValueFirst) || (Def->ValueLast >= Def->Bits) || (Def->ValueLast - Def->ValueFirst > 31)))
+    return false;
+  if ((Def->ValueFirst == FLEX_NONE) != (Def->ValueLast == FLEX_NONE))
+    return false;
+  if ((Def->Check > FLEX_CHECK_CRC8) || ((Def->Check == FLEX_CHECK_CRC8) && (Def->Poly == 0)))
+    return false;
+  return true;
+}
+
+// EEPROM.begin() is done by setup() on ESP. A slot that does not hold a valid definition is cleared.
+void FlexLoad(void)
+{
+  byte *Data = (byte *)Flex;
+
+  memset(Flex, 0, sizeof(Flex));
+  if (EEPROM.read(FLEX_EEPROM_ADDR) != FLEX_EEPROM_MAGIC)
+    return; // never saved, no flex decoder
+  for (unsigned int i = 0; i < sizeof(Flex); i++)
+    Data[i] = EEPROM.read(FLEX_EEPROM_ADDR + 1 + i);
+  for (byte Slot = 0; Slot < FLEX_SLOTS; Slot++)
+    if (!FlexValid(&Flex[Slot]))
+      memset(&Flex[Slot], 0, sizeof(Flex[Slot])); // FLEX_OFF
+}
+
+static void FlexSave(void)
+{
+  const byte *Data = (const byte *)Flex;
+  boolean Changed;
+
+  Changed = EepromUpdate(FLEX_EEPROM_ADDR, FLEX_EEPROM_MAGIC);
+  for (unsigned int i = 0; i < sizeof(Flex); i++)
+    Changed |= EepromUpdate(FLEX_EEPROM_ADDR + 1 + i, Data[i]);
+#if (defined(ESP32) || defined(ESP8266))
+  if (Changed)
+    EEPROM.commit();
+#endif
+}
+
+/*********************************************************************************************\
+ * Definition parsing and display
+ \*********************************************************************************************/
+// Number at *Text, at most Max. *Text moves past it.
+static boolean FlexNumber(char **Text, unsigned long Max, unsigned long *Value)
+{
+  char *End;
+
+  if (!isdigit(**Text))
+    return false;
+  *Value = strtoul(*Text, &End, 10);
+  *Text = End;
+  return (*Value <= Max);
+}
+
+// Range first[-last] at *Text, last is first when missing
+static boolean FlexRange(char **Text, unsigned long Max, unsigned long *First, unsigned long *Last)
+{
+  if (!FlexNumber(Text, Max, First))
+    return false;
+  *Last = *First;
+  if (**Text != '-')
+    return true;
+  (*Text)++;
+  return FlexNumber(Text, Max, Last) && (*Last >= *First);
+}
+
+// Bit range of an id or value, may be empty
+static boolean FlexBitRange(char **Text, const FlexStruct *Def, byte *First, byte *Last)
+{
+  unsigned long From, To;
+
+  if ((**Text == ',') || (**Text == ';') || (**Text == 0))
+  {
+    *First = *Last = FLEX_NONE;
+    return true;
+  }
+  if (!FlexRange(Text, Def->Bits - 1, &From, &To) || (To - From > 31))
+    return false;
+  *First = From;
+  *Last = To;
+  return true;
+}
+
+static boolean FlexComma(char **Text)
+{
+  if (**Text != ',')
+    return false;
+  (*Text)++;
+  return true;
+}
+
+static boolean FlexParse(char *Text, FlexStruct *Def)
+{
+  unsigned long First, Last;
+
+  memset(Def, 0, sizeof(*Def));
+  if (strncasecmp_P(Text, PSTR("PWM"), 3) == 0)
+    Def->Mode = FLEX_PWM;
+  else if (strncasecmp_P(Text, PSTR("PPM"), 3) == 0)
+    Def->Mode = FLEX_PPM;
+  else if (strncasecmp_P(Text, PSTR("MAN"), 3) == 0)
+    Def->Mode = FLEX_MAN;
+  else
+    return false;
+  Text += 3;
+
+  if (!FlexComma(&Text) || !FlexRange(&Text, RAW_BUFFER_SIZE, &First, &Last))
+    return false;
+  Def->MinPulses = First;
+  Def->MaxPulses = Last;
+  if (!FlexComma(&Text) || !FlexNumber(&Text, 0xFF * RAWSIGNAL_SAMPLE_RATE, &First))
+    return false;
+  if (!FlexComma(&Text) || !FlexNumber(&Text, 0xFF * RAWSIGNAL_SAMPLE_RATE, &Last) || (Last < First))
+    return false;
+  if ((First == 0) != (Last == 0))
+    return false; // both from the frame clock or none
+  Def->Short = PULSE_FLOOR(First);
+  Def->Long = PULSE_FLOOR(Last);
+  if ((First != 0) && (Def->Short >= Def->Long))
+    return false; // too close to tell apart
+  if (!FlexComma(&Text) || !FlexNumber(&Text, 64, &First) || (First == 0))
+    return false;
+  Def->Bits = First;
+  for (;; Text++)
+  {
+    if ((*Text == 'L') || (*Text == 'l'))
+      Def->Mode |= FLEX_LSB;
+    else if ((*Text == 'I') || (*Text == 'i'))
+      Def->Mode |= FLEX_INVERT;
+    else
+      break;
+  }
+  if (!FlexComma(&Text) || !FlexNumber(&Text, 0xFF, &First))
+    return false; // Pulses[] position kept in a byte
+  Def->First = First;
+  if (!FlexComma(&Text) || !FlexBitRange(&Text, Def, &Def->IdFirst, &Def->IdLast))
+    return false;
+  if (!FlexComma(&Text) || !FlexBitRange(&Text, Def, &Def->ValueFirst, &Def->ValueLast))
+    return false;
+
+  if (FlexComma(&Text))
+  {
+    if (strncasecmp_P(Text, PSTR("CRC8-"), 5) == 0)
+    {
+      Def->Check = FLEX_CHECK_CRC8;
+      if (!isxdigit(Text[5]))
+        return false;
+      Last = strtoul(Text + 5, &Text, 16);
+      if ((Last == 0) || (Last > 0xFF))
+        return false;
+      Def->Poly = Last;
+    }
+    else
+    {
+      if (strncasecmp_P(Text, PSTR("XOR"), 3) == 0)
+        Def->Check = FLEX_CHECK_XOR;
+      else if (strncasecmp_P(Text, PSTR("ADD"), 3) == 0)
+        Def->Check = FLEX_CHECK_ADD;
+      else if (strncasecmp_P(Text, PSTR("PAR"), 3) == 0)
+        Def->Check = FLEX_CHECK_PAR;
+      else
+        return false;
+      Text += 3;
+    }
+  }
+  return ((*Text == ';') || (*Text == 0));
+}
+
+static void FlexFormat(const FlexStruct *Def, char *Text)
+{
+  static const char Modes[] PROGMEM = "PWMPPMMAN";
+  char *Out = Text;
+
+  memcpy_P(Out, &Modes[((Def->Mode & FLEX_MODE) - 1) * 3], 3);
+  Out += 3;
+  Out += sprintf_P(Out, PSTR(",%d"), Def->MinPulses);
+  if (Def->MaxPulses != Def->MinPulses)
+    Out += sprintf_P(Out, PSTR("-%d"), Def->MaxPulses);
+  Out += sprintf_P(Out, PSTR(",%d,%d,%d"), Def->Short * RAWSIGNAL_SAMPLE_RATE, Def->Long * RAWSIGNAL_SAMPLE_RATE, Def->Bits);
+  if (Def->Mode & FLEX_LSB)
+    *Out++ = 'L';
+  if (Def->Mode & FLEX_INVERT)
+    *Out++ = 'I';
+  Out += sprintf_P(Out, PSTR(",%d,"), Def->First);
+  if (Def->IdFirst != FLEX_NONE)
+    Out += sprintf_P(Out, PSTR("%d-%d"), Def->IdFirst, Def->IdLast);
+  *Out++ = ',';
+  if (Def->ValueFirst != FLEX_NONE)
+    Out += sprintf_P(Out, PSTR("%d-%d"), Def->ValueFirst, Def->ValueLast);
+  switch (Def->Check)
+  {
+  case FLEX_CHECK_XOR:
+    Out += sprintf_P(Out, PSTR(",XOR"));
+    break;
+  case FLEX_CHECK_ADD:
+    Out += sprintf_P(Out, PSTR(",ADD"));
+    break;
+  case FLEX_CHECK_PAR:
+    Out += sprintf_P(Out, PSTR(",PAR"));
+    break;
+  case FLEX_CHECK_CRC8:
+    Out += sprintf_P(Out, PSTR(",CRC8-%02X"), Def->Poly);
+    break;
+  }
+  *Out = 0;
+}
+
+boolean FlexCommand(byte Slot, char *Definition)
+{
+  char Text[INPUT_COMMAND_SIZE];
+  FlexStruct Def;
+
+  if ((Slot < 1) || (Slot > FLEX_SLOTS))
+    return false;
+  if (Definition != NULL)
+  {
+    Definition++; // past '='
+    if (strncasecmp_P(Definition, PSTR("OFF"), 3) == 0)
+      memset(&Def, 0, sizeof(Def));
+    else if (!FlexParse(Definition, &Def))
+      return false; // slot and EEPROM left as they were
+    Flex[Slot - 1] = Def;
+    FlexSave();
+  }
+
+  if (Flex[Slot - 1].Mode == FLEX_OFF)
+    strcpy_P(Text, PSTR("OFF"));
+  else
+    FlexFormat(&Flex[Slot - 1], Text);
+  display_FLEXDEF(Slot, Text);
+  return true;
+}
+
+/*********************************************************************************************\
+ * Decoding
+ \*********************************************************************************************/
+// Manchester: odd pulses are high, each one is one or two half bits. Bits are read from pairs
+// of half bits, high then low is a 1. The low half of the last bit may be lost in the end gap.
+static boolean FlexManchester(const FlexStruct *Def, byte Mid, byte End, unsigned long long *Message)
+{
+  unsigned long long Bits = 0;
+  byte Count = 0;
+  int Half = -1; // level of a first half bit waiting for its second half
+  byte Level;
+  byte Halves;
+  int x;
+
+  for (x = Def->First; (x <= RawSignal.Number) && (Count < Def->Bits); x++)
+  {
+    Level = x & 1;
+    if (RawSignal.Pulses[x] > End)
+    {
+      if ((Half == 1) && (Level == 0))
+      { // end gap holds the low half of the last bit
+        Bits = (Bits << 1) | 1;
+        Count++;
+      }
+      break;
+    }
+    for (Halves = (RawSignal.Pulses[x] > Mid) ? 2 : 1; Halves > 0; Halves--)
+    {
+      if (Half < 0)
+        Half = Level;
+      else if (Half == Level)
+        return false; // no transition in the middle of the bit
+      else
+      {
+        Bits = (Bits << 1) | Half;
+        Half = -1;
+        if (++Count == Def->Bits)
+          break;
+      }
+    }
+  }
+  *Message = Bits;
+  return (Count == Def->Bits);
+}
+
+// Bits First..Last of Message (left aligned), right aligned
+static unsigned long FlexField(unsigned long long Message, byte First, byte Last)
+{
+  return (unsigned long)((Message << First) >> (63 - (Last - First)));
+}
+
+static boolean FlexDecode(byte Slot)
+{
+  const FlexStruct *Def = &Flex[Slot];
+  PulseCodeStruct Code;
+  unsigned long long Message;
+  unsigned long Bits[2];
+  byte Data[8];
+  byte Bytes = Def->Bits / 8;
+  byte Short = Def->Short;
+  byte Long = Def->Long;
+  byte i;
+
+  if (Short == 0)
+  { // clusters of this frame
+    Short = RawFeatures.Short;
+    Long = RawFeatures.Long;
+    if (Short >= Long)
+      return false;
+  }
+
+  if ((Def->Mode & FLEX_MODE) == FLEX_MAN)
+  {
+    if (!FlexManchester(Def, (Short + Long) / 2, (Long + Long / 2 > 0xFF) ? 0xFF : Long + Long / 2, &Message))
+      return false;
+  }
+  else
+  {
+    Code.First = Def->First + (((Def->Mode & FLEX_MODE) == FLEX_PPM) ? 1 : 0);
+    Code.Bits = Def->Bits;
+    Code.Step = 2;
+    Code.Mid = (Short + Long) / 2;
+    Code.ShortMin = Short / 2;
+    Code.ShortMax = Code.Mid;
+    Code.LongMax = (Long + Long / 2 > 0xFF) ? 0xFF : Long + Long / 2;
+    Code.Other = 0; // the pulse after the last bit is often the end gap
+    Code.OtherMax = 0xFF;
+    Code.Flags = 0;
+    if (!PulseCodeDecodeRAM(&Code, Bits))
+      return false;
+    Message = (Def->Bits > 32) ? (((unsigned long long)Bits[0] << (Def->Bits - 32)) | Bits[1]) : Bits[0];
+  }
+
+  Message <<= 64 - Def->Bits; // left aligned, bit 0 first
+  if (Def->Mode & FLEX_INVERT)
+    Message = ~Message & (~0ULL << (64 - Def->Bits));
+  for (i = 0; i < 8; i++)
+    Data[i] = Message >> (56 - 8 * i);
+  if (Def->Mode & FLEX_LSB)
+  {
+    reflect_bytes(Data, 8);
+    for (Message = 0, i = 0; i < 8; i++)
+      Message = (Message << 8) | Data[i];
+  }
+
+  switch (Def->Check)
+  {
+  case FLEX_CHECK_XOR:
+    if ((Bytes < 2) || (xor_bytes(Data, Bytes - 1) != Data[Bytes - 1]))
+      return false;
+    break;
+  case FLEX_CHECK_ADD:
+    if ((Bytes < 2) || ((add_bytes(Data, Bytes - 1) & 0xFF) != Data[Bytes - 1]))
+      return false;
+    break;
+  case FLEX_CHECK_PAR:
+    if ((Bytes < 1) || parity_bytes(Data, Bytes))
+      return false;
+    break;
+  case FLEX_CHECK_CRC8:
+    if ((Bytes < 2) || (crc8(Data, Bytes - 1, Def->Poly, 0) != Data[Bytes - 1]))
+      return false;
+    break;
+  }
+
+  //==================================================================================
+  // Prevent repeating signals from showing up
+  //==================================================================================
+  unsigned long Crc = (unsigned long)(Message >> 32) ^ (unsigned long)Message ^ Slot;
+  if (SignalRepeat(Crc, SIGNAL_REPEAT_TIME_MS))
+    return true; // already seen the RF packet recently
+  //==================================================================================
+  // Output
+  //==================================================================================
+  display_Header();
+  display_FLEX(Slot + 1);
+  if (Def->IdFirst != FLEX_NONE)
+    display_IDn(FlexField(Message, Def->IdFirst, Def->IdLast), ((Def->IdLast - Def->IdFirst) / 8 + 1) * 2);
+  if (Def->ValueFirst != FLEX_NONE)
+    display_VALUE(FlexField(Message, Def->ValueFirst, Def->ValueLast));
+  display_Footer();
+  return true;
+}
+
+boolean Plugin_Flex(byte function, char *string)
+{
+  for (byte Slot = 0; Slot < FLEX_SLOTS; Slot++)
+  {
+    if ((Flex[Slot].Mode == FLEX_OFF) || (RawSignal.Number < Flex[Slot].MinPulses) || (RawSignal.Number > Flex[Slot].MaxPulses))
+      continue;
+    if (FlexDecode(Slot))
+    {
+      RawSignal.Repeats = true; // suppress repeats of the same RF packet
+      RawSignal.Number = 0;
+      return true;
+    }
+  }
+  return false;
+}
+#endif // FLEX_DECODER
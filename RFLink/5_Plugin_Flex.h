@@ -0,0 +1,41 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef Plugin_Flex_h
+#define Plugin_Flex_h
+
+#include <Arduino.h>
+#include "RFLink.h"
+
+#ifdef FLEX_DECODER
+// ***********************************************************************************
+// Flex decoders: PWM / PPM / Manchester decoders defined at runtime for devices that have
+// no plugin, kept in EEPROM. They get the frames that none of the plugins before them decoded.
+//
+// 10;FLEXn=<mode>,<pulses>,<short>,<long>,<bits>,<first>,<id>,<value>[,<check>];
+//   mode    PWM: bit in the first pulse of each pair, PPM: bit in the second one,
+//           MAN: Manchester, short is half a bit, a high then low bit is a 1
+//   pulses  RawSignal.Number, or a min-max range
+//   short   short and long pulse in uSec, 0,0 takes them from the clock of each frame
+//   long
+//   bits    number of bits, up to 64. Suffix L: LSB first in each byte, I: inverted bits
+//   first   position in Pulses[] of the first pulse of the first bit, up to 255
+//   id      bit range first-last (0 is the first bit received, up to 32 bits) or empty
+//   value   bit range, like id
+//   check   XOR, ADD or CRC8-<hex polynomial 1..FF>: of the first whole bytes, equal to the last one
+//           PAR: even parity of all whole bytes
+// 10;FLEXn; shows the definition, 10;FLEXn=OFF; deletes it. A wrong definition changes nothing.
+// Decoded packets: 20;xx;Flexn;ID=<id>;VALUE=<value>;
+// ***********************************************************************************
+#define FLEX_PLUGIN_ID 253 // in Plugin_table[], 10;PLUGIN253=OFF; disables all flex decoders
+
+void FlexLoad(void);
+boolean FlexCommand(byte Slot, char *Definition); // Definition points to '=' or is NULL, answer in Event
+boolean Plugin_Flex(byte function, char *string);
+#endif
+
+#endif // Plugin_Flex_h
@@ -21,5 +21,7 @@ const char* MQTT_PSWD      = "your_mqtt_pswd";
 // MQTT Topic
 const char* MQTT_TOPIC_OUT = "/RFLink/msg";
 const char* MQTT_TOPIC_IN  = "/RFLink/cmd";
+const char* MQTT_TOPIC_STATS = "/RFLink/stats";
+const char* MQTT_TOPIC_JSON = "/RFLink"; // MQTT_JSON: /RFLink/Oregon_TempHygro/1a2b
 
 #endif
@@ -9,6 +9,7 @@
 #include "RFLink.h"
 #if (defined(ESP32) || defined(ESP8266))
 
+#include "3_Serial.h"
 #include "4_Display.h"
 #include "6_WiFi_MQTT.h"
 
@@ -26,6 +27,11 @@
 // MQTT_SOCKET_TIMEOUT: socket timeout interval in Seconds
 #define MQTT_SOCKET_TIMEOUT 60
 
+#ifdef MQTT_JSON
+#define MQTT_TOPIC_SIZE 64 // MQTT_TOPIC_JSON/<name>/<ID>[/<SWITCH>]
+#define MQTT_JSON_SIZE 160 // JSON payload, more than PRINT_BUFFER_SIZE for the names of the fields
+#endif
+
 #include <PubSubClient.h>
 #include "6_Credentials.h"
 
@@ -69,21 +75,20 @@ void setup_MQTT()
 {
   MQTTClient.setClient(WIFIClient);
   MQTTClient.setServer(MQTT_SERVER, MQTT_PORT);
-  // MQTTClient.setCallback(callback);
+  MQTTClient.setCallback(callback);
 }
 
-/*
-  void callback(char* topic, byte* payload, unsigned int length) {
-  Serial.print(F("Message arrived ["));
-  Serial.print(topic);
-  Serial.print("] ");
-  for (unsigned int i = 0; i < length; i++) {
-    Serial.write(payload[i]);
-  }
-  Serial.write('\n');
-  Serial.println();
-  }
-*/
+// Commands on MQTT_TOPIC_IN are the serial ones (10;...;), answer is left in Event for sendMsg()
+void callback(char *topic, byte *payload, unsigned int length)
+{
+  char Command[INPUT_COMMAND_SIZE];
+
+  if (length > INPUT_COMMAND_SIZE - 1)
+    length = INPUT_COMMAND_SIZE - 1;
+  memcpy(Command, payload, length);
+  Command[length] = 0;
+  ExecuteCommand(Command);
+}
 
 void reconnect()
 {
@@ -97,7 +102,7 @@ void reconnect()
     {
       Serial.println(F("Connected"));
       // Once connected, resubscribe
-      // MQTTClient.subscribe(MQTT_TOPIC_IN);
+      MQTTClient.subscribe(MQTT_TOPIC_IN);
     }
     else
     {
@@ -111,18 +116,51 @@ void reconnect()
   }
 }
 
-void publishMsg()
+// false when the broker is away and Event was not sent (EVENT_QUEUE: checkMQTTloop() reconnects)
+boolean publishMsg()
 {
   if (!MQTTClient.connected())
   {
+#ifdef EVENT_QUEUE
+    return false;
+#else
     reconnect();
+#endif
+  }
+#ifdef MQTT_JSON
+  if (Event.Protocol != 0)
+  { // decoded event, the answers to commands stay on MQTT_TOPIC_OUT
+    char Topic[MQTT_TOPIC_SIZE];
+    char Payload[MQTT_JSON_SIZE];
+
+    EventTopic(Topic, sizeof(Topic), MQTT_TOPIC_JSON);
+    EventJSON(Payload, sizeof(Payload));
+#ifdef MQTT_RETAINED
+    MQTTClient.publish(Topic, Payload, true);
+#else  // MQTT_RETAINED
+    MQTTClient.publish(Topic, Payload, false);
+#endif // MQTT_RETAINED
+    return true;
   }
+#endif // MQTT_JSON
 #ifdef MQTT_RETAINED
   MQTTClient.publish(MQTT_TOPIC_OUT, pbuffer, true);
 #else  // MQTT_RETAINED
   MQTTClient.publish(MQTT_TOPIC_OUT, pbuffer, false);
 #endif // MQTT_RETAINED
+  return true;
+}
+
+#ifdef PLUGIN_STATS
+void publishStats()
+{
+  if (!MQTTClient.connected())
+  {
+    reconnect();
+  }
+  MQTTClient.publish(MQTT_TOPIC_STATS, pbuffer, false);
 }
+#endif // PLUGIN_STATS
 
 void checkMQTTloop()
 {
@@ -132,7 +170,13 @@ void checkMQTTloop()
   {
     if (!MQTTClient.connected())
     {
+#ifdef EVENT_QUEUE
+      // One attempt per MQTT_LOOP_MS, the events wait in the queue meanwhile
+      if (MQTTClient.connect(MQTT_ID, MQTT_USER, MQTT_PSWD))
+        MQTTClient.subscribe(MQTT_TOPIC_IN);
+#else
       reconnect();
+#endif
     }
     // Serial.print(F("Calling MQTT loop()..."));
     MQTTClient.loop();
@@ -18,7 +18,11 @@ extern char MQTTbuffer[PRINT_BUFFER_SIZE]; // Buffer for MQTT message
 void setup_WIFI();
 void setup_MQTT();
 void reconnect();
-void publishMsg();
+void callback(char *topic, byte *payload, unsigned int length);
+boolean publishMsg();
+#ifdef PLUGIN_STATS
+void publishStats();
+#endif
 void checkMQTTloop();
 #else
 void setup_WIFI_OFF();
@@ -10,6 +10,7 @@
 */
 
 #include "7_Utils.h"
+#include <EEPROM.h>
 // #include <stdlib.h>
 // #include <stdio.h>
 // #include <string.h>
@@ -314,6 +315,14 @@ int add_nibbles(uint8_t const message[], unsigned num_bytes)
     return result;
 }
 
+bool EepromUpdate(int address, uint8_t value)
+{
+    if (EEPROM.read(address) == value)
+        return false;
+    EEPROM.write(address, value);
+    return true;
+}
+
 // Unit testing
 #ifdef _TEST
 int main(int argc, char **argv) {
@@ -175,4 +175,11 @@ int add_bytes(uint8_t const message[], unsigned num_bytes);
 /// @return summation value
 int add_nibbles(uint8_t const message[], unsigned num_bytes);
 
+/// Write a byte to EEPROM unless it already holds it, each write wears the EEPROM / flash a bit.
+///
+/// @param address EEPROM address
+/// @param value byte to write
+/// @return true when the byte was written, EEPROM.commit() is then needed on ESP
+bool EepromUpdate(int address, uint8_t value);
+
 #endif /* INCLUDE_UTIL_H_ */
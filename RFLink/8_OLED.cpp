@@ -75,7 +75,7 @@ void print_OLED()
     }
 */
     u8x8log.print('\f');
-    replacechar(pbuffer, ';', '\n');
+    EventLines();
     u8x8log.print(pbuffer);
 }
 
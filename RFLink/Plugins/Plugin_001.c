@@ -83,7 +83,11 @@
 #define PULSE6000 6000 / RAWSIGNAL_SAMPLE_RATE
 #define PULSE6500 6500 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_001_MINPULSES 0
+#define PLUGIN_001_MAXPULSES RAW_BUFFER_SIZE
+
 #ifdef PLUGIN_001
+#include "../3_Serial.h"
 #include "../4_Display.h"
 
 boolean Plugin_001(byte function, char *string)
@@ -210,22 +214,7 @@ boolean Plugin_001(byte function, char *string)
       display_Name(PSTR("DEBUG"));
       display_Footer();
       // ----------------------------------
-      Serial.print(F("20;XX;DEBUG;Pulses=")); // debug data
-      Serial.print(RawSignal.Number);         // print number of pulses
-      Serial.print(F(";Pulses(uSec)="));      // print pulse durations
-      // ----------------------------------
-      for (i = 1; i < RawSignal.Number + 1; i++)
-      {
-         if (QRFDebug == true)
-            Serial.printf("%02x", RawSignal.Pulses[i]);
-         else
-         {
-            Serial.print(RawSignal.Pulses[i] * RAWSIGNAL_SAMPLE_RATE);
-            if (i < RawSignal.Number)
-               Serial.write(',');
-         }
-      }
-      Serial.print(F(";\r\n"));
+      SerialPulses(); // debug data
       // ----------------------------------
       RawSignal.Number = 0; // Last plugin, kill packet
       return true;          // stop processing
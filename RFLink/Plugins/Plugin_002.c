@@ -64,6 +64,9 @@
 
 #define LACROSSE_PULSEMID 1000 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_002_MINPULSES (LACROSSE_PULSECOUNT - 2)
+#define PLUGIN_002_MAXPULSES LACROSSE_PULSECOUNT
+
 #ifdef PLUGIN_002
 #include "../4_Display.h"
 
@@ -160,9 +163,7 @@ boolean Plugin_002(byte function, char *string)
    //==================================================================================
    unsigned long tmpval = (bitstream1 << 4) | (data[12]); // sensor type + ID + checksum
 
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen this RF packet recently, save value for later
-   else
+   if (SignalRepeat(tmpval, 250))
       return true; // already seen the RF packet recently
    //==================================================================================
    // now process the various sensor types
@@ -170,7 +171,7 @@ boolean Plugin_002(byte function, char *string)
    // Output
    // ----------------------------------
    data[2] = (data[2] & B1011); // get sensor type from bitstream
-   char c_ID[4];
+   char c_ID[5];
    sprintf(c_ID, "%02X%02X", data[3], data[4]);
 
    if (data[2] == B0000) // Temperature
@@ -221,8 +221,32 @@
 #define KAKU_R 300 / RAWSIGNAL_SAMPLE_RATE        //360 // 300          // 370? 350 us
 #define KAKU_PULSEMID 600 / RAWSIGNAL_SAMPLE_RATE // (17)  510 = KAKU_R*2 not sufficient!
 
+#define PLUGIN_003_MINPULSES ((KAKU_CodeLength * 4) + 2)
+#define PLUGIN_003_MAXPULSES ((KAKU_CodeLength * 4) + 2)
+
 #ifdef PLUGIN_003
 #include "../4_Display.h"
+#include "../5_Plugin_Decode.h"
+
+// Device type from the shortest / longest pulse, first match wins
+struct KakuTimingStruct
+{
+   byte LowMin, LowMax;
+   byte HighMin, HighMax;
+   byte DeviceType;
+};
+
+const KakuTimingStruct KAKU_Timing[] PROGMEM = {
+    {7, 8, 30, 31, 4},   // ELRO AB400
+    {9, 10, 36, 37, 1},  // ELRO AB600
+    {9, 10, 40, 42, 1},  // ELRO AB600
+    {10, 11, 40, 42, 2}, // Profile PR44N  / Promax rsl366t
+    {13, 13, 32, 34, 3}, // Profile PR47N
+    {11, 12, 31, 37, 4}, // Sartano
+    {12, 13, 45, 46, 4}, // Philips SBC
+    {0, 3, 22, 23, 5},   // Philips SBC
+    // {8, 9, 33, 34, 7}, // Perel st=0,dt=7
+};
 
 boolean Plugin_003(byte function, char *string)
 {
@@ -237,6 +261,8 @@ boolean Plugin_003(byte function, char *string)
    // -------------------------------------------
    int i, j;
    boolean error = false;
+   byte symbols[KAKU_CodeLength];
+   KakuTimingStruct timing;
    unsigned long bitstream = 0L;  // to store a 12 bit code (ARC type)
    unsigned long bitstream2 = 0L; // to store a 24 bit code (Extended ARC type)
    byte tricount = 0;
@@ -257,6 +283,8 @@ boolean Plugin_003(byte function, char *string)
    // ==========================================================================
    j = KAKU_PULSEMID; // set MID value
    j--;
+   if (RawFeatures.Ratio == 3)
+      j = PulseUnits(16); // T/3T coding: split at 2T of the recovered clock, fits slow and fast remotes alike
    if (RawSignal.Pulses[0] == 33)
    {                           // If device is "Impuls"
       RawSignal.Pulses[0] = 0; // Unset Impuls conversion indicator
@@ -267,74 +295,58 @@ boolean Plugin_003(byte function, char *string)
    if (RawSignal.Pulses[49] > j)
       return false; // Last pulse has to be low! Otherwise we are not dealing with an ARC signal
    // ==========================================================================
-   // TIMING MEASUREMENT, this will find the shortest and longest pulse within the RF packet
+   // TIMING MEASUREMENT, shortest and longest pulse within the RF packet (first pulse skipped
+   // as it is often affected by the start bit pulse duration), measured once in RawFeatures
    // ==========================================================================
-   for (i = 2; i < RawSignal.Number; i++) // skip first pulse as it is often affected by the start bit pulse duration
-   {
-      if (RawSignal.Pulses[i] < PTLow)       // shortest pulse?
-         PTLow = RawSignal.Pulses[i];        // new value
-      else if (RawSignal.Pulses[i] > PTHigh) // longest pulse?
-         PTHigh = RawSignal.Pulses[i];       // new value
-   }
+   if (RawFeatures.Min < PTLow)
+      PTLow = RawFeatures.Min;
+   if (RawFeatures.Max > PTHigh)
+      PTHigh = RawFeatures.Max;
    // -------------------------------------------
    // TIMING MEASUREMENT to devicetype
    if (devicetype != 5)
    { // Dont do the timing check for Impuls, it is already identified at this point
-      if (((PTLow == 7) || (PTLow == 8)) && ((PTHigh == 30) || (PTHigh == 31)))
-         devicetype = 4; // ELRO AB400
-      if (((PTLow == 9) || (PTLow == 10)) && ((PTHigh == 36) || (PTHigh == 37) || ((PTHigh >= 40) && (PTHigh <= 42))))
-         devicetype = 1; // ELRO AB600
-      else if (((PTLow == 10) || (PTLow == 11)) && ((PTHigh >= 40) && (PTHigh <= 42)))
-         devicetype = 2; // Profile PR44N  / Promax rsl366t
-      else if ((PTLow == 13) && ((PTHigh >= 32) && (PTHigh <= 34)))
-         devicetype = 3; // Profile PR47N
-      else if (((PTLow >= 11) && (PTLow <= 12)) && ((PTHigh >= 31) && (PTHigh <= 37)))
-         devicetype = 4; // Sartano
-      else if (((PTLow == 12) || (PTLow == 13)) && ((PTHigh == 45) || (PTHigh == 46)))
-         devicetype = 4; // Philips SBC
-      else if ((PTLow <= 3) && ((PTHigh == 22) || (PTHigh == 23)))
-         devicetype = 5; // Philips SBC
-      //else
-      //if( (PTLow == 8 ||  PTLow == 9) && (PTHigh == 33 ||  PTHigh == 34) ) devicetype=7; // Perel st=0,dt=7
+      for (i = 0; i < (int)(sizeof(KAKU_Timing) / sizeof(KAKU_Timing[0])); i++)
+      {
+         memcpy_P(&timing, &KAKU_Timing[i], sizeof(timing));
+         if ((PTLow >= timing.LowMin) && (PTLow <= timing.LowMax) && (PTHigh >= timing.HighMin) && (PTHigh <= timing.HighMax))
+         {
+            devicetype = timing.DeviceType;
+            break;
+         }
+      }
    }
    //sprintf(pbuffer, "ST=%d DT=%d %d/%d",signaltype,devicetype,PTLow,PTHigh);
    //Serial.println( pbuffer );
    // ==========================================================================
    // Turn pulses into bits
    // -------------------------------------------
+   TristateDecode(1, KAKU_CodeLength, j, symbols);
    for (i = 0; i < KAKU_CodeLength; i++)
    {
-      if (RawSignal.Pulses[4 * i + 1] < j && RawSignal.Pulses[4 * i + 2] > j && RawSignal.Pulses[4 * i + 3] < j && RawSignal.Pulses[4 * i + 4] > j)
-      {                                  // 0101
+      switch (symbols[i])
+      {
+      case TRISTATE_0:                   // 0101
          bitstream = (bitstream >> 1);   // bit '0'
          bitstream2 = (bitstream2 << 2); // bit '0' written as '00'
          signaltype = signaltype | 1;    // bit '0' present in signal '0001'
-      }
-      else if (RawSignal.Pulses[4 * i + 1] < j && RawSignal.Pulses[4 * i + 2] > j && RawSignal.Pulses[4 * i + 3] > j && RawSignal.Pulses[4 * i + 4] < j)
-      {              // 0110
-                     //!! untested !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+         break;
+      case TRISTATE_F: // 0110
+         //!! untested !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
          tricount++; // tri-state bit counter
-         if ((i == 11) && (tricount == 1))
-         {                                                               // only the last bit, "on/off command" is in tristate mode? then it must be EMW200
-            bitstream = (bitstream >> 1 | (1 << (KAKU_CodeLength - 1))); // bit f (1)
-            bitstream2 = (bitstream2 << 2) | 2;                          // bit 'f' written as '10'
-            // DONT CHANGE signal type to tri-state to keep EMW200 in KAKU mode
-         }
-         else
-         {
-            bitstream = (bitstream >> 1 | (1 << (KAKU_CodeLength - 1))); // bit f (1)
-            bitstream2 = (bitstream2 << 2) | 2;                          // bit 'f' written as '10'
-            signaltype = signaltype | 2;                                 // bit 'f' present in signal '0010'
-         }
-      }
-      else if (RawSignal.Pulses[4 * i + 1] < j && RawSignal.Pulses[4 * i + 2] > j && RawSignal.Pulses[4 * i + 3] < j && RawSignal.Pulses[4 * i + 4] < j)
-      {                                      // 0100
+         bitstream = (bitstream >> 1 | (1 << (KAKU_CodeLength - 1))); // bit f (1)
+         bitstream2 = (bitstream2 << 2) | 2;                          // bit 'f' written as '10'
+         // only the last bit, "on/off command" is in tristate mode? then it must be EMW200
+         // DONT CHANGE signal type to tri-state to keep EMW200 in KAKU mode
+         if (!((i == 11) && (tricount == 1)))
+            signaltype = signaltype | 2; // bit 'f' present in signal '0010'
+         break;
+      case TRISTATE_SHORT0:                  // 0100
          bitstream = (bitstream >> 1);       // Short 0, Group command on 2nd bit.  (NOT USED?!)
          bitstream2 = (bitstream2 << 2) | 3; // bit 'short' written as '11'
          group = 1;
-      }
-      else if (RawSignal.Pulses[4 * i + 1] > j && RawSignal.Pulses[4 * i + 2] < j && RawSignal.Pulses[4 * i + 3] > j && RawSignal.Pulses[4 * i + 4] < j)
-      {                                      // 1010
+         break;
+      case TRISTATE_1:                       // 1010
          bitstream2 = (bitstream2 << 2) | 1; // bit '1' written as '01'
          signaltype = signaltype | 4;        // bit '1' present in signal '0100'
          if (devicetype == 5)
@@ -353,31 +365,21 @@ boolean Plugin_003(byte function, char *string)
                bitstream = (bitstream >> 1 | (1 << (KAKU_CodeLength - 1))); // bit f (1)
             }
          }
-      }
-      else
-      {
-         // -------------------------------------------
-         // following are signal patches to fix bad transmission/receptions
-         // -------------------------------------------
+         break;
+      case TRISTATE_0D: // 1101
+         // are we dealing with a RTK/AB600 device? then the first bit is sometimes mistakenly seen as 1101
          if (i == 0)
-         {                                  // are we dealing with a RTK/AB600 device? then the first bit is sometimes mistakenly seen as 1101
-            bitstream2 = (bitstream2 << 2); // bit 0
-            if (RawSignal.Pulses[4 * i + 1] > j && RawSignal.Pulses[4 * i + 2] > j && RawSignal.Pulses[4 * i + 3] < j && RawSignal.Pulses[4 * i + 4] > j)
-            {                                // 1101
-               bitstream = (bitstream >> 1); // 0, treat as 0101 eg 0 bit
-            }
-            else
-            {
-               error = true;
-               signaltype = signaltype | 8;
-            }
-         }
-         else
          {
-            error = true;
-            signaltype = signaltype | 8;
+            bitstream2 = (bitstream2 << 2); // bit 0
+            bitstream = (bitstream >> 1);   // 0, treat as 0101 eg 0 bit
+            break;
          }
-      } // bad signal
+         // fall through
+      default:
+         // signal patches above fix bad transmission/receptions, anything else is an error
+         error = true;
+         signaltype = signaltype | 8;
+      }
    }
    //==================================================================================
    // Sort out devices based on signal type and timing measurements
@@ -398,36 +400,15 @@ boolean Plugin_003(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   //if( (SignalHash!=SignalHashPrevious) || ((RepeatingTimer+500)<millis()) ) {
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (((RepeatingTimer + 1000) > millis()) && (SignalCRC != bitstream2)))
-   {
-      // not seen the RF packet recently
-      if (signaltype == 0x07)
-      {
-         if (((RepeatingTimer + 1000) > millis()) && (SignalCRC != bitstream2))
-         {
-            return true; // skip tristate after normal arc
-         }
-      }
-      //Serial.print("KAKU PREV:");
-      //Serial.println(SignalHashPrevious);
-      if ((SignalHashPrevious == 14) && ((RepeatingTimer + 2000) > millis()))
-      {
-         SignalHash = 14;
-         return true; // SignalHash 14 = HomeEasy, eg. cant switch KAKU after HE for 2 seconds
-      }
-      if ((SignalHashPrevious == 11) && ((RepeatingTimer + 2000) > millis()))
-      {
-         SignalHash = 11;
-         return true; // SignalHash 11 = FA500, eg. cant switch KAKU after FA500 for 2 seconds
-      }
-      SignalCRC = bitstream2; // store RF packet identifier
-   }
-   else
-   {
-      // already seen the RF packet recently
-      return true;
-   }
+   boolean arc = SignalSeen(3, 1250); // another KAKU packet just before
+   if (SignalRepeat(bitstream2, 750))
+      return true; // already seen the RF packet recently
+   if ((signaltype == 0x07) && arc)
+      return true; // skip tristate after normal arc
+   if (SignalSeen(15, 2250))
+      return true; // HomeEasy, eg. cant switch KAKU after HE for 2 seconds
+   if (SignalSeen(12, 2250))
+      return true; // FA500, eg. cant switch KAKU after FA500 for 2 seconds
    //==================================================================================
    // Determine signal type to sort out the various houdecode/unitcode/button bits and on/off command bits
    //==================================================================================
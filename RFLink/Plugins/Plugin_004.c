@@ -48,6 +48,9 @@
 #define NewKAKUdim_RawSignalLength 148         // KAKU packet length including DIM bits
 #define NewKAKU_mT 650 / RAWSIGNAL_SAMPLE_RATE // us, approx. in between 1T and 4T
 
+#define PLUGIN_004_MINPULSES NewKAKU_RawSignalLength
+#define PLUGIN_004_MAXPULSES NewKAKUdim_RawSignalLength
+
 #ifdef PLUGIN_004
 #include "../4_Display.h"
 
@@ -58,7 +61,7 @@ boolean Plugin_004(byte function, char *string)
       return false;
    if (RawSignal.Pulses[0] == 15)
       return true; // Home Easy, skip KAKU
-   boolean Bit;
+   boolean Bit = 0;
    int i;
    //int P0,P1,P2,P3;
    byte P0, P1, P2, P3;
@@ -110,23 +113,12 @@ boolean Plugin_004(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 700) < millis()) || (SignalCRC != bitstream))
-   { // 1000
-      // not seen the RF packet recently
-      //if ((SignalHashPrevious==14) && ((RepeatingTimer+2000)>millis()) ) {
-      //   SignalHash=14;
-      //   return true;                            // SignalHash 14 = HomeEasy, eg. cant switch KAKU after HE for 2 seconds
-      //}
-      if ((SignalHashPrevious == 11) && ((RepeatingTimer + 2000) > millis()))
-      {
-         SignalHash = 11;
-         return true; // SignalHash 11 = FA500, eg. cant switch KAKU after FA500 for 2 seconds
-      }
-
-      SignalCRC = bitstream;
-   }
-   else
+   if (SignalRepeat(bitstream, 950)) // 1250
       return true; // already seen the RF packet recently
+   //if (SignalSeen(15, 2250))
+   //   return true;                            // HomeEasy, eg. cant switch KAKU after HE for 2 seconds
+   if (SignalSeen(12, 2250))
+      return true; // FA500, eg. cant switch KAKU after FA500 for 2 seconds
    //==================================================================================
    // Output
    //==================================================================================
@@ -45,8 +45,15 @@
 #define EURODOMEST_PULSEMIN 100 / RAWSIGNAL_SAMPLE_RATE
 #define EURODOMEST_PULSEMAX 900 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_005_MINPULSES EURODOMEST_PulseLength
+#define PLUGIN_005_MAXPULSES EURODOMEST_PulseLength
+
 #ifdef PLUGIN_005
 #include "../4_Display.h"
+#include "../5_Plugin_Decode.h"
+
+// long/short or short/long pulse pairs, bit is the length of the second pulse
+const PulseCodeStruct EURODOMEST_Code PROGMEM = {2, 24, 2, EURODOMEST_PULSEMID, EURODOMEST_PULSEMIN, EURODOMEST_PULSEMID, EURODOMEST_PULSEMAX, -1, 0xFF, PULSECODE_OPPOSITE};
 
 boolean Plugin_005(byte function, char *string)
 {
@@ -56,6 +63,7 @@ boolean Plugin_005(byte function, char *string)
       return false; // No need to test, packet for plugin 63
 
    unsigned long bitstream = 0;
+   unsigned long bits[2];
    byte unitcode = 0;
    byte command = 0;
    unsigned int address = 0;
@@ -67,26 +75,9 @@ boolean Plugin_005(byte function, char *string)
    //==================================================================================
    // Get all 24 bits
    //==================================================================================
-   for (int x = 2; x < EURODOMEST_PulseLength; x += 2)
-   {
-      bitstream <<= 1; //Always shift
-      if (RawSignal.Pulses[x] > EURODOMEST_PULSEMID)
-      { // long pulse
-         if (RawSignal.Pulses[x - 1] > EURODOMEST_PULSEMID)
-            return false; // not a 01 or 10 transmission
-         if (RawSignal.Pulses[x] > EURODOMEST_PULSEMAX)
-            return false; // make sure the long pulse is within range
-         bitstream |= 0x1;
-      }
-      else
-      { // short pulse
-         if (RawSignal.Pulses[x] < EURODOMEST_PULSEMIN)
-            return false; // pulse too short to be Eurodomest
-         if (RawSignal.Pulses[x - 1] < EURODOMEST_PULSEMID)
-            return false; // not a 01 or 10 transmission
-         // bitstream |= 0x0;
-      }
-   }
+   if (!PulseCodeDecode(&EURODOMEST_Code, bits))
+      return false; // not a 01 or 10 transmission, or pulse out of range
+   bitstream = bits[0];
 
    //==================================================================================
    // Perform a quick sanity check
@@ -96,9 +87,7 @@ boolean Plugin_005(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (SignalRepeat(bitstream, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Perform more sanity checks to prevent false positives
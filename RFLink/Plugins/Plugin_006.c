@@ -39,8 +39,15 @@
 #define BLYSS_PULSECOUNT 106
 #define BLYSS_PULSEMID 500 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_006_MINPULSES BLYSS_PULSECOUNT
+#define PLUGIN_006_MAXPULSES BLYSS_PULSECOUNT
+
 #ifdef PLUGIN_006
 #include "../4_Display.h"
+#include "../5_Plugin_Decode.h"
+
+// one bit every two pulses, long pulse is a 0
+const PulseCodeStruct BLYSS_Code PROGMEM = {2, (BLYSS_PULSECOUNT - 2) / 2, 2, BLYSS_PULSEMID, 0, BLYSS_PULSEMID, 0xFF, 0, 0xFF, PULSECODE_LONG_IS_0};
 
 boolean Plugin_006(byte function, char *string)
 {
@@ -48,41 +55,16 @@ boolean Plugin_006(byte function, char *string)
       return false;
    unsigned long bitstream = 0L;
    unsigned long bitstream1 = 0L;
-   byte bitcounter = 0;
+   unsigned long bits[2];
    byte checksum = 0;
    int type = 0;
    //==================================================================================
    // Get all 52 bits
    //==================================================================================
-   for (byte x = 2; x < BLYSS_PULSECOUNT; x += 2)
-   {
-      if (RawSignal.Pulses[x] > BLYSS_PULSEMID)
-      {
-         if (bitcounter < 32)
-         {
-            bitstream <<= 1;
-         }
-         else
-         {
-            bitstream1 <<= 1;
-         }
-         bitcounter++;
-      }
-      else
-      {
-         if (bitcounter < 32)
-         {
-            bitstream <<= 1;
-            bitstream |= 0x1;
-         }
-         else
-         {
-            bitstream1 <<= 1;
-            bitstream1 |= 0x1;
-         }
-         bitcounter++;
-      }
-   }
+   if (!PulseCodeDecode(&BLYSS_Code, bits))
+      return false;
+   bitstream = bits[0];  // first 32 bits
+   bitstream1 = bits[1]; // last 20 bits
    //==================================================================================
    // all bits received, make sure checksum is okay
    //==================================================================================
@@ -94,9 +76,7 @@ boolean Plugin_006(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream;   // not seen the RF packet recently
-   else
+   if (SignalRepeat(bitstream, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    byte status = ((bitstream1) >> 16) & 0x0f;
@@ -47,6 +47,9 @@
 
 #define CONRADRSL2_PULSEMID 600 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_007_MINPULSES CONRADRSL2_PULSECOUNT
+#define PLUGIN_007_MAXPULSES (CONRADRSL2_PULSECOUNT + 2)
+
 #ifdef PLUGIN_007
 #include "../4_Display.h"
 
@@ -92,9 +95,7 @@ boolean Plugin_007(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (SignalRepeat(bitstream, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    // all bits received, make sure checksum is okay
@@ -36,6 +36,9 @@
 
 #define KAMBROOK_PULSEMID 400 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_008_MINPULSES KAMBROOK_PULSECOUNT
+#define PLUGIN_008_MAXPULSES KAMBROOK_PULSECOUNT
+
 #ifdef PLUGIN_008
 #include "../4_Display.h"
 
@@ -114,11 +117,7 @@ boolean Plugin_008(byte function, char *string)
     //==================================================================================
     // Prevent repeating signals from showing up
     //==================================================================================
-    if (SignalHash != SignalHashPrevious || RepeatingTimer < millis())
-    {
-        // not seen the RF packet recently
-    }
-    else
+    if (SignalRepeat((address << 8) | command, 250))
         return true; // already seen the RF packet recently
     //==================================================================================
     //==================================================================================
@@ -48,6 +48,9 @@
 
 #define X10_PULSEMID 600 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_009_MINPULSES X10_PulseLength
+#define PLUGIN_009_MAXPULSES (X10_PulseLength + 2)
+
 #ifdef PLUGIN_009
 #include "../4_Display.h"
 
@@ -66,7 +69,7 @@ boolean Plugin_009(byte function, char *string)
    //==================================================================================
    if (RawSignal.Number == X10_PulseLength + 2)
    {
-      if ((RawSignal.Pulses[1] * RawSignal.Multiply > 3000) && (RawSignal.Pulses[2] * RawSignal.Multiply > 3000))
+      if ((RawSignal.Pulses[1] > PULSE_FLOOR(3000)) && (RawSignal.Pulses[2] > PULSE_FLOOR(3000)))
          start = 2;
       else
          return false; // not an X10 packet
@@ -90,9 +93,7 @@ boolean Plugin_009(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 1000 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (SignalRepeat(bitstream, 1250))
       return true; // already seen the RF packet recently
    //==================================================================================
    // order received data
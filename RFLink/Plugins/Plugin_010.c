@@ -56,6 +56,9 @@
 #define RGB_PULSE_LOHI 600 / RAWSIGNAL_SAMPLE_RATE
 #define RGB_PULSE_LOLO 400 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_010_MINPULSES RGB_MIN_PULSECOUNT
+#define PLUGIN_010_MAXPULSES RGB_MAX_PULSECOUNT
+
 #ifdef PLUGIN_010
 #include "../4_Display.h"
 
@@ -93,7 +96,7 @@ boolean Plugin_010(byte function, char *string)
             continue;
          }
       }
-      if (RawSignal.Pulses[x] * RawSignal.Multiply > 750 && RawSignal.Pulses[x] * RawSignal.Multiply < 1000)
+      if (RawSignal.Pulses[x] > PULSE_FLOOR(750) && RawSignal.Pulses[x] < PULSE_CEIL(1000))
       {
          if (halfbit == 1) // cant receive a 1 bit after a single low value
             return false;  // pulse error, must not be a UPM packet or reception error
@@ -117,7 +120,7 @@ boolean Plugin_010(byte function, char *string)
       }
       else
       {
-         if (RawSignal.Pulses[x] * RawSignal.Multiply > 625 && RawSignal.Pulses[x] * RawSignal.Multiply < 250)
+         if (RawSignal.Pulses[x] > PULSE_FLOOR(625) && RawSignal.Pulses[x] < PULSE_CEIL(250))
             return false; // Not a valid UPM pulse length
 
          if (halfbit == 0) // 2 times a low value = 0 bit
@@ -145,7 +148,7 @@ boolean Plugin_010(byte function, char *string)
    }
    //==================================================================================
    // Validity checks
-   if (RawSignal.Pulses[x + 2] * RawSignal.Multiply < 1200 || RawSignal.Pulses[x + 2] * RawSignal.Multiply > 1500)
+   if (RawSignal.Pulses[x + 2] < PULSE_CEIL(1200) || RawSignal.Pulses[x + 2] > PULSE_FLOOR(1500))
       return false;
    //==================================================================================
    // perform a checksum check to make sure the packet is a valid RGB control packet
@@ -57,6 +57,9 @@
 #define HC_PLUGIN_ID 011
 #define HC_PULSECOUNT 100
 
+#define PLUGIN_011_MINPULSES HC_PULSECOUNT
+#define PLUGIN_011_MAXPULSES HC_PULSECOUNT
+
 #ifdef PLUGIN_011
 #include "../4_Display.h"
 
@@ -64,7 +67,7 @@ boolean Plugin_011(byte function, char *string)
 {
    if (RawSignal.Number != HC_PULSECOUNT)
       return false;
-   if (RawSignal.Pulses[1] * RawSignal.Multiply < 2000)
+   if (RawSignal.Pulses[1] < PULSE_CEIL(2000))
       return false; // First (start) pulse needs to be long
 
    unsigned long bitstream1 = 0; // holds first 24 bits
@@ -79,11 +82,11 @@ boolean Plugin_011(byte function, char *string)
    //==================================================================================
    for (int x = 2; x < HC_PULSECOUNT - 2; x += 2)
    { // get bytes
-      if (RawSignal.Pulses[x] * RawSignal.Multiply > 500)
+      if (RawSignal.Pulses[x] > PULSE_FLOOR(500))
       { // long pulse
-         if (RawSignal.Pulses[x] * RawSignal.Multiply > 800)
+         if (RawSignal.Pulses[x] > PULSE_FLOOR(800))
             return false; // Pulse range check
-         if (RawSignal.Pulses[x + 1] * RawSignal.Multiply > 400)
+         if (RawSignal.Pulses[x + 1] > PULSE_FLOOR(400))
             return false; // Manchester check
          if (bitcounter < 24)
          {
@@ -99,9 +102,9 @@ boolean Plugin_011(byte function, char *string)
       }
       else
       { // short pulse
-         if (RawSignal.Pulses[x] * RawSignal.Multiply > 300)
+         if (RawSignal.Pulses[x] > PULSE_FLOOR(300))
             return false; // pulse range check
-         if (RawSignal.Pulses[x + 1] * RawSignal.Multiply < 400)
+         if (RawSignal.Pulses[x + 1] < PULSE_CEIL(400))
             return false; // Manchester check
          if (bitcounter < 24)
          {
@@ -116,9 +119,9 @@ boolean Plugin_011(byte function, char *string)
       if (bitcounter > 50)
          break;
    }
-   if (RawSignal.Pulses[98] * RawSignal.Multiply > 300)
+   if (RawSignal.Pulses[98] > PULSE_FLOOR(300))
       return false; // pulse range check, last two pulses should be short
-   if (RawSignal.Pulses[99] * RawSignal.Multiply > 300)
+   if (RawSignal.Pulses[99] > PULSE_FLOOR(300))
       return false; // pulse range check
    //==================================================================================
    // first perform a check to make sure the packet is valid
@@ -134,9 +137,7 @@ boolean Plugin_011(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if (SignalHash != SignalHashPrevious || ((RepeatingTimer + 500) < millis()) || SignalCRC != bitstream2)
-      SignalCRC = bitstream2; // not seen the RF packet recently
-   else
+   if (SignalRepeat(bitstream2, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    // now process the command / switch settings
@@ -82,6 +82,9 @@
 
 #define FA500_PULSEMID 400 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_012_MINPULSES FA500RM3_PulseLength
+#define PLUGIN_012_MAXPULSES FA500RM1_PulseLength
+
 #ifdef PLUGIN_012
 #include "../4_Display.h"
 
@@ -174,11 +177,11 @@ boolean Plugin_012(byte function, char *string)
       }
       command = 2; // initialize to "unknown"
       // Trick: here we use the on/off command from the other packet type as it is not detected in the current packet, it was passed via Pluses[0] in plugin 1
-      if (RawSignal.Pulses[0] * RawSignal.Multiply > 1000 && RawSignal.Pulses[0] * RawSignal.Multiply < 1400)
+      if (RawSignal.Pulses[0] > PULSE_FLOOR(1000) && RawSignal.Pulses[0] < PULSE_CEIL(1400))
       {
          command = 0;
       }
-      else if (RawSignal.Pulses[0] * RawSignal.Multiply > 100 && RawSignal.Pulses[0] * RawSignal.Multiply < 400)
+      else if (RawSignal.Pulses[0] > PULSE_FLOOR(100) && RawSignal.Pulses[0] < PULSE_CEIL(400))
       {
          command = 1;
       }
@@ -209,7 +212,7 @@ boolean Plugin_012(byte function, char *string)
    {
       display_IDn(((unitcode << 8) | housecode), 8); // "%02x%02x"
 
-      char c_SWITCH[4];
+      char c_SWITCH[5];
       sprintf(c_SWITCH, "%02x%02x", unitcode, housecode);
       display_SWITCHc(c_SWITCH); // "%02x%02x"
    }
@@ -95,6 +95,9 @@
 #define POWEFIX_PULSEMIN 450 / RAWSIGNAL_SAMPLE_RATE
 #define POWEFIX_PULSEMAX 1400 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_013_MINPULSES POWERFIX_PulseLength
+#define PLUGIN_013_MAXPULSES POWERFIX_PulseLength
+
 #ifdef PLUGIN_013
 #include "../4_Display.h"
 
@@ -150,9 +153,7 @@ boolean Plugin_013(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if (SignalHash != SignalHashPrevious || (RepeatingTimer < millis() + 1500) || SignalCRC != bitstream)
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (SignalRepeat(bitstream, 1750))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Sort data
@@ -41,6 +41,9 @@
 #define KOPPLA_PULSEMAX 1850 / RAWSIGNAL_SAMPLE_RATE
 #define KOPPLA_PULSEMIN 650 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_014_MINPULSES KOPPLA_PulseLength_MIN
+#define PLUGIN_014_MAXPULSES KOPPLA_PulseLength_MAX
+
 #ifdef PLUGIN_014
 #include "../4_Display.h"
 
@@ -52,6 +52,9 @@
 
 #define HomeEasy_PULSEMID 500 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_015_MINPULSES HomeEasy_PulseLength
+#define PLUGIN_015_MAXPULSES HomeEasy_PulseLength
+
 #ifdef PLUGIN_015
 #include "../4_Display.h"
 
@@ -99,9 +102,7 @@ boolean Plugin_015(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if (SignalHash != SignalHashPrevious || (RepeatingTimer < millis() + 500) || SignalCRC != bitstream)
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (SignalRepeat(bitstream, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    type = ((bitstream >> 12) & 0x3); // 11b for HE301
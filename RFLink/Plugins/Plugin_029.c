@@ -58,6 +58,9 @@
 
 #define DKW2012_PULSEMINMAX 768 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_029_MINPULSES ACH2010_MIN_PULSECOUNT
+#define PLUGIN_029_MAXPULSES DKW2012_MAX_PULSECOUNT
+
 #ifdef PLUGIN_029
 #include "../4_Display.h"
 
@@ -120,9 +123,7 @@ boolean Plugin_029(byte function, char *string)
   //==================================================================================
   unsigned long tmpval = data[0] << 8 | data[1];
 
-  if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 1000 < millis()) || (SignalCRC != tmpval))
-    SignalCRC = tmpval; // not seen the RF packet recently
-  else
+  if (SignalRepeat(tmpval, 1250))
     return true; // already seen the RF packet recently
   //==================================================================================
   // Now process the various sensor types
@@ -98,6 +98,9 @@
 #define ALECTOV1_MIDHI 700 / RAWSIGNAL_SAMPLE_RATE
 #define ALECTOV1_PULSEMAXMIN 2560 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_030_MINPULSES ALECTOV1_PULSECOUNT
+#define PLUGIN_030_MAXPULSES ALECTOV1_PULSECOUNT
+
 #ifdef PLUGIN_030
 #include "../4_Display.h"
 
@@ -146,13 +149,8 @@ boolean Plugin_030(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 1000 < millis()) || ((SignalCRC != bitstream) && (SignalCRC_1 != bitstream)))
-   {
-      SignalCRC_1 = SignalCRC; // for mixed message burst prevention
-      SignalCRC = bitstream;   // not seen the RF packet recently
-   }
-   else
-      return true; // already seen the RF packet recently
+   if (SignalRepeat(bitstream, 1250)) // each message of a mixed burst has its own entry
+      return true;                    // already seen the RF packet recently
    //==================================================================================
    // Prepare nibbles from bit stream
    //==================================================================================
@@ -183,7 +181,7 @@ boolean Plugin_030(byte function, char *string)
    data[3] = (data[3]) & B0111;    // prepare nibble to contain only the needed bits
    //==================================================================================
    rc = (data[1] << 4) | data[0];
-   char c_ID[4];
+   char c_ID[5];
    sprintf(c_ID, "%04X", (rc & 0x03) << 2 | (rc & 0xFC));
 
    if ((data[2]) != B0110)
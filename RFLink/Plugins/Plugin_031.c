@@ -69,6 +69,9 @@
 
 #define ALECTOV3_PULSEMID 300 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_031_MINPULSES WS1100_PULSECOUNT
+#define PLUGIN_031_MAXPULSES WS1200_PULSECOUNT
+
 #ifdef PLUGIN_031
 #include "../4_Display.h"
 
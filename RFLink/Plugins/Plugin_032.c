@@ -47,6 +47,9 @@
 #define ALECTOV4_PULSEMINMAX 2500 / RAWSIGNAL_SAMPLE_RATE
 #define ALECTOV4_PULSEMAXMIN 3000 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_032_MINPULSES ALECTOV4_PULSECOUNT
+#define PLUGIN_032_MAXPULSES (ALECTOV4_PULSECOUNT + 4)
+
 #ifdef PLUGIN_032
 #include "../4_Display.h"
 
@@ -117,9 +120,7 @@ boolean Plugin_032(byte function, char *string)
    //==================================================================================
    unsigned long tmpval = (((bitstream << 8) & 0xFFF0) | humidity); // All but 8 1st ID bits ...
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen this RF packet recently
-   else
+   if (SignalRepeat(tmpval, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Now process the various sensor types
@@ -149,7 +150,7 @@ boolean Plugin_032(byte function, char *string)
    //==================================================================================
    display_Header();
    display_Name(PSTR("Alecto V4"));
-   char c_ID[4];
+   char c_ID[5];
    sprintf(c_ID, "%02x%02x", rc, rc2);
    display_IDc(c_ID);
    display_TEMP(temperature);
@@ -37,6 +37,9 @@
 #define CONRAD_PULSEMAX 5000 / RAWSIGNAL_SAMPLE_RATE
 #define CONRAD_PULSEMIN 2300 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_033_MINPULSES CONRAD_PULSECOUNT
+#define PLUGIN_033_MAXPULSES CONRAD_PULSECOUNT
+
 #ifdef PLUGIN_033
 #include "../4_Display.h"
 
@@ -92,9 +95,7 @@ boolean Plugin_033(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (SignalRepeat(bitstream, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Perform checksum calculations
@@ -31,9 +31,13 @@
 
 #define CRESTA_PULSEMID 700 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_034_MINPULSES CRESTA_MIN_PULSECOUNT
+#define PLUGIN_034_MAXPULSES CRESTA_MAX_PULSECOUNT
+
 #ifdef PLUGIN_034
 #include "../4_Display.h"
 #include "../7_Utils.h"
+#include "../5_Plugin_Decode.h"
 
 byte Plugin_034_WindDirSeg(byte data);
 
@@ -42,11 +46,8 @@ boolean Plugin_034(byte function, char *string)
    if ((RawSignal.Number < CRESTA_MIN_PULSECOUNT) || (RawSignal.Number > CRESTA_MAX_PULSECOUNT))
       return false;
 
-   byte bytecounter = 0;  // used for counting the number of received bytes
-   byte bitcounter = 0;   // counts number of received bits (converted from pulses)
-   int pulseposition = 1; // first pulse is always empty
-   byte halfbit = 0;      // high pulse = 1, 2 low pulses = 0, halfbit keeps track of low pulses
-   byte parity = 0;       // to calculate byte parity
+   int bitcounter = 0;   // number of received bits with a valid parity
+   byte bytecounter = 0; // used for counting the number of received bytes
 
    byte checksum = 0;
    byte data[18];
@@ -66,65 +67,12 @@ boolean Plugin_034(byte function, char *string)
    // and determine if byte parity is set correctly
    // for the cresta protocol on the fly
    //==================================================================================
-   do
-   {
-      if (RawSignal.Pulses[pulseposition] > CRESTA_PULSEMID)
-      {                    // high value = 1 bit
-         if (halfbit == 1) // cant receive a 1 bit after a single low value
-            return false;  // pulse error, must not be a Cresta packet or reception error
-
-         if (bitcounter == 8)
-         {
-            if (parity != 1) // now receiving parity bit
-               return false; // parity error, must not be a Cresta packet or reception error
-            else
-            {
-               bitcounter = 0; // reset for next byte
-               parity = 0;     // reset for next byte
-               halfbit = 0;    // wait for next first low or high pulse
-               bytecounter++;  // 1 byte received
-            }
-         }
-         else
-         {
-            data[bytecounter] <<= 1;
-            data[bytecounter] |= 0x1; // 1 bit
-            parity ^= 1;              // update parity
-            bitcounter++;             // received a bit
-            halfbit = 0;              // waiting for first low or a new high pulse
-         }
-      }
-      else
-      {
-         if (halfbit == 0) // 2 times a low value = 0 bit
-            halfbit = 1;   // first half received
-         else
-         {
-            if (bitcounter == 8)
-            {
-               if (parity != 0) // now receiving parity bit
-                  return false; // parity error, must not be a Cresta packet or reception error
-               else
-               {
-                  bitcounter = 0; // reset for next byte
-                  parity = 0;     // reset for next byte
-                  halfbit = 0;    // wait for next first low or high pulse
-                  bytecounter++;  // 1 byte received
-               }
-            }
-            else
-            {
-               data[bytecounter] <<= 1; // 0 bit
-               parity ^= 0;             // update parity
-               bitcounter++;            // received a bit
-               halfbit = 0;             // wait for next first low or high pulse
-            }
-         }
-      }
-      pulseposition++; // point to next pulse
-      if (pulseposition > RawSignal.Number)
-         break;                // reached the end? done processing
-   } while (bytecounter < 16); // receive maximum number of bytes from pulses
+   // high pulse = 1, 2 low pulses = 0, every byte is followed by a parity bit
+   // first pulse is always empty, receive maximum 16 bytes
+   bitcounter = PulseHalfDecode(1, RawSignal.Number, CRESTA_PULSEMID, 0xFF, PULSEHALF_BIPHASE | PULSEHALF_PARITY, data, 16 * 8);
+   if (bitcounter < 0)
+      return false; // pulse or parity error, must not be a Cresta packet or reception error
+   bytecounter = bitcounter / 8;
    //==================================================================================
    // Perform checksum calculations
    //==================================================================================
@@ -167,9 +115,7 @@ boolean Plugin_034(byte function, char *string)
    //==================================================================================
    unsigned long tmpval = (data[3] << 16) | ((data[1]) << 8) | channel;
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen the RF packet recently
-   else
+   if (SignalRepeat(tmpval, 750))
       return true; // already seen the RF packet recently
    // ----------------------------------
    battery = !((data[2]) >> 6);
@@ -210,7 +156,7 @@ boolean Plugin_034(byte function, char *string)
       //==================================================================================
       display_Header();
       display_Name(PSTR("Cresta"));
-      char c_ID[4];
+      char c_ID[5];
       sprintf(c_ID, "%02X%02X", data[1], channel);
       display_IDc(c_ID);
       display_WINDIR(winddirection);
@@ -241,7 +187,7 @@ boolean Plugin_034(byte function, char *string)
       //==================================================================================
       display_Header();
       display_Name(PSTR("Cresta"));
-      char c_ID[4];
+      char c_ID[5];
       sprintf(c_ID, "%02X%02X", data[1], channel);
       display_IDc(c_ID);
       display_TEMP(sensor_data);
@@ -262,7 +208,7 @@ boolean Plugin_034(byte function, char *string)
       //==================================================================================
       display_Header();
       display_Name(PSTR("Cresta"));
-      char c_ID[4];
+      char c_ID[5];
       sprintf(c_ID, "%02X%02X", data[1], channel);
       display_IDc(c_ID);
       display_RAIN(sensor_data);
@@ -285,7 +231,7 @@ boolean Plugin_034(byte function, char *string)
       //==================================================================================
       display_Header();
       display_Name(PSTR("Cresta"));
-      char c_ID[4];
+      char c_ID[5];
       sprintf(c_ID, "%02X%02X", data[1], channel);
       display_IDc(c_ID);
       display_TEMP(sensor_data);
@@ -301,7 +247,7 @@ boolean Plugin_034(byte function, char *string)
       //==================================================================================
       display_Header();
       display_Name(PSTR("Cresta;DEBUG"));
-      char c_ID[4];
+      char c_ID[5];
       sprintf(c_ID, "%02X%02X", data[1], channel);
       display_IDc(c_ID);
       display_Footer();
@@ -42,6 +42,9 @@
 #define IMAGINTRONIX_PULSEMID 1000 / RAWSIGNAL_SAMPLE_RATE
 #define IMAGINTRONIX_PULSESHORT 550 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_035_MINPULSES IMAGINTRONIX_PULSECOUNT
+#define PLUGIN_035_MAXPULSES IMAGINTRONIX_PULSECOUNT
+
 #ifdef PLUGIN_035
 #include "../4_Display.h"
 
@@ -111,9 +114,7 @@ boolean Plugin_035(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (SignalRepeat(bitstream, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    rc = (data[1]) & 0x3;
@@ -52,6 +52,9 @@
 #define MEBUS_PULSEMINMAX 2100 / RAWSIGNAL_SAMPLE_RATE
 #define MEBUS_PULSEMAXMIN 3400 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_040_MINPULSES MEBUS_PULSECOUNT
+#define PLUGIN_040_MAXPULSES MEBUS_PULSECOUNT
+
 #ifdef PLUGIN_040
 #include "../4_Display.h"
 
@@ -95,9 +98,7 @@ boolean Plugin_040(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 150 < millis() && SignalCRC != bitstream) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (SignalRepeat(bitstream, 400))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Prepare nibbles from bit stream
@@ -137,7 +138,7 @@ boolean Plugin_040(byte function, char *string)
    //==================================================================================
    display_Header();
    display_Name(PSTR("Mebus"));
-   char c_ID[4];
+   char c_ID[5];
    sprintf(c_ID, "%02x%02x", rc, channel);
    display_IDc(c_ID);
    display_TEMP(temperature);
@@ -87,6 +87,9 @@
 
 #define LACROSSE41_PULSEMID 500 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_041_MINPULSES LACROSSE41_PULSECOUNT1
+#define PLUGIN_041_MAXPULSES LACROSSE41_PULSECOUNT2
+
 #ifdef PLUGIN_041
 #include "../4_Display.h"
 
@@ -162,9 +165,7 @@ boolean Plugin_041(byte function, char *string)
    //==================================================================================
    unsigned long tempval = (((data[4]) >> 1) << 16) | ((data[3]) << 8) | data[2];
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 150) < millis()) || (SignalCRC != tempval))
-      SignalCRC = tempval; // not seen this RF packet recently
-   else
+   if (SignalRepeat(tempval, 400))
       return true; // already seen the RF packet recently, but still want the humidity
    //==================================================================================
    // now process the various sensor types
@@ -173,7 +174,7 @@ boolean Plugin_041(byte function, char *string)
    //==================================================================================
    display_Header();
    display_Name(PSTR("LaCrosseV3"));
-   char c_ID[4];
+   char c_ID[5];
    sprintf(c_ID, "%02X%02X", data[0], data[1]);
    display_IDc(c_ID);
 
@@ -95,6 +95,9 @@
 #define UPM_PULSEHIHI 2075 / RAWSIGNAL_SAMPLE_RATE
 #define UPM_PULSEHILO 1600 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_042_MINPULSES UPM_MIN_PULSECOUNT
+#define PLUGIN_042_MAXPULSES UPM_MAX_PULSECOUNT
+
 #ifdef PLUGIN_042
 #include "../4_Display.h"
 
@@ -205,9 +208,7 @@ boolean Plugin_042(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream1))
-      SignalCRC = bitstream1; // not seen the RF packet recently
-   else
+   if (SignalRepeat(bitstream1, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    // now process the various sensor types
@@ -229,7 +230,7 @@ boolean Plugin_042(byte function, char *string)
          //==================================================================================
          display_Header();
          display_Name(PSTR("UPM/Esic"));
-         char c_ID[4];
+         char c_ID[5];
          sprintf(c_ID, "%02X%02X", rc, devicecode);
          display_IDc(c_ID);
          display_WINSP(winds);
@@ -246,7 +247,7 @@ boolean Plugin_042(byte function, char *string)
          //==================================================================================
          display_Header();
          display_Name(PSTR("UPM/Esic"));
-         char c_ID[4];
+         char c_ID[5];
          sprintf(c_ID, "%02X%02X", rc, devicecode);
          display_IDc(c_ID);
          display_RAIN(rain);
@@ -269,7 +270,7 @@ boolean Plugin_042(byte function, char *string)
          //==================================================================================
          display_Header();
          display_Name(PSTR("UPM/Esic"));
-         char c_ID[4];
+         char c_ID[5];
          sprintf(c_ID, "%02X%02X", rc, devicecode);
          display_IDc(c_ID);
          display_TEMP(temperature);
@@ -292,7 +293,7 @@ boolean Plugin_042(byte function, char *string)
       //==================================================================================
       display_Header();
       display_Name(PSTR("UPM/Esic F2"));
-      char c_ID[4];
+      char c_ID[5];
       sprintf(c_ID, "%02X%02X", rc, devicecode);
       display_IDc(c_ID);
       display_TEMP(temperature);
@@ -96,6 +96,9 @@
 #define LACROSSE43_PULSEMAXMIN 1120 / RAWSIGNAL_SAMPLE_RATE //1410 //990
 #define LACROSSE43_PULSEMAX 1440 / RAWSIGNAL_SAMPLE_RATE    //2100 //1500
 
+#define PLUGIN_043_MINPULSES (LACROSSE43_PULSECOUNT - 4)
+#define PLUGIN_043_MAXPULSES (LACROSSE43_PULSECOUNT + 4)
+
 #ifdef PLUGIN_043
 #include "../4_Display.h"
 
@@ -201,9 +204,7 @@ boolean Plugin_043(byte function, char *string)
    //==================================================================================
    unsigned long tmpval = (bitstream1 << 4) | (data[10]); // sensor type + ID + checksum
 
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen this RF packet recently
-   else
+   if (SignalRepeat(tmpval, 250))
       return true; // already seen the RF packet recently, but still want the humidity
    //==================================================================================
    // now process the various sensor types
@@ -220,7 +221,7 @@ boolean Plugin_043(byte function, char *string)
       //==================================================================================
       display_Header();
       display_Name(PSTR("LaCrosse"));
-      char c_ID[4];
+      char c_ID[5];
       sprintf(c_ID, "%02X%02X", data[3], data[4]);
       display_IDc(c_ID);
       display_TEMP(temperature);
@@ -240,7 +241,7 @@ boolean Plugin_043(byte function, char *string)
       //==================================================================================
       display_Header();
       display_Name(PSTR("LaCrosse"));
-      char c_ID[4];
+      char c_ID[5];
       sprintf(c_ID, "%02X%02X", data[3], data[4]);
       display_IDc(c_ID);
       display_HUM(humidity, HUM_HEX);
@@ -37,12 +37,16 @@
 #define AURIOLV3_PLUGIN_ID 044
 #define AURIOLV3_PULSECOUNT 82
 
+// Gap between the bits: up to 650 uSec, in samples
 #define AURIOLV3_MIDHI 650 / RAWSIGNAL_SAMPLE_RATE
 
 #define AURIOLV3_PULSEMIN 1500 / RAWSIGNAL_SAMPLE_RATE
 #define AURIOLV3_PULSEMINMAX 2000 / RAWSIGNAL_SAMPLE_RATE
 #define AURIOLV3_PULSEMAXMIN 3500 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_044_MINPULSES AURIOLV3_PULSECOUNT
+#define PLUGIN_044_MAXPULSES AURIOLV3_PULSECOUNT
+
 #ifdef PLUGIN_044
 #include "../4_Display.h"
 
@@ -63,7 +67,7 @@ boolean Plugin_044(byte function, char *string)
    //==================================================================================
    for (byte x = 2; x < AURIOLV3_PULSECOUNT; x += 2)
    {
-      if (RawSignal.Pulses[x + 1] * RawSignal.Multiply > AURIOLV3_MIDHI)
+      if (RawSignal.Pulses[x + 1] > AURIOLV3_MIDHI)
          return false;
       if (RawSignal.Pulses[x] > AURIOLV3_PULSEMAXMIN)
       {
@@ -97,17 +101,12 @@ boolean Plugin_044(byte function, char *string)
    //==================================================================================
    // Perform sanity checks and prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer < millis()))
-   {
-      if (bitstream1 == 0)
-         return false; // not seen the RF packet recently
-      if (bitstream2 == 0)
-         return false;
-   }
-   else
-   {
+   if (bitstream1 == 0)
+      return false;
+   if (bitstream2 == 0)
+      return false;
+   if (SignalRepeat(bitstream1 ^ (bitstream2 << 16), 250))
       return true; // already seen the RF packet recently
-   }
    //==================================================================================
    // now process sensor type
    //==================================================================================
@@ -134,7 +133,7 @@ boolean Plugin_044(byte function, char *string)
    //==================================================================================
    display_Header();
    display_Name(PSTR("Auriol V3"));
-   char c_ID[4];
+   char c_ID[5];
    sprintf(c_ID, "%02X%02X", rc, channel);
    display_IDc(c_ID);
    display_TEMP(temperature);
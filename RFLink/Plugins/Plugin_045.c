@@ -41,8 +41,15 @@
 #define AURIOL_PULSEMINMAX 2200 / RAWSIGNAL_SAMPLE_RATE
 #define AURIOL_PULSEMAXMIN 3000 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_045_MINPULSES AURIOL_PULSECOUNT
+#define PLUGIN_045_MAXPULSES AURIOL_PULSECOUNT
+
 #ifdef PLUGIN_045
 #include "../4_Display.h"
+#include "../5_Plugin_Decode.h"
+
+// long pulse is a 1, pulses in between must be short
+const PulseCodeStruct AURIOL_Code PROGMEM = {2, 32, 2, AURIOL_PULSEMAXMIN, AURIOL_PULSEMIN, AURIOL_PULSEMINMAX, 0xFF, 1, AURIOL_MIDHI, 0};
 
 boolean Plugin_045(byte function, char *string)
 {
@@ -50,6 +57,7 @@ boolean Plugin_045(byte function, char *string)
       return false;
 
    unsigned long bitstream = 0L; // holds 8x4=32 bits
+   unsigned long bits[2];
    byte checksumcalc = 0;
    byte rc = 0;
    byte bat = 0;
@@ -57,25 +65,9 @@ boolean Plugin_045(byte function, char *string)
    //==================================================================================
    // Get all 32 bits
    //==================================================================================
-   for (byte x = 2; x < AURIOL_PULSECOUNT; x += 2)
-   {
-      if (RawSignal.Pulses[x + 1] > AURIOL_MIDHI)
-         return false; // in between pulses should not exceed a length of 550
-
-      bitstream <<= 1; // Always shift
-
-      if (RawSignal.Pulses[x] > AURIOL_PULSEMAXMIN)
-         bitstream |= 0x1; // long bit = 1
-      else
-      {
-         if (RawSignal.Pulses[x] < AURIOL_PULSEMIN)
-            return false; // pulse length too short to be valid?
-         if (RawSignal.Pulses[x] > AURIOL_PULSEMINMAX)
-            return false; // pulse length between 2000 - 3000 is invalid
-
-         // bitstream |= 0x0; // short bit = 0
-      }
-   }
+   if (!PulseCodeDecode(&AURIOL_Code, bits))
+      return false; // pulse length out of range
+   bitstream = bits[0];
    //==================================================================================
    // Perform a quick sanity check
    //==================================================================================
@@ -84,9 +76,7 @@ boolean Plugin_045(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (SignalRepeat(bitstream, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Perform checksum calculations
@@ -123,7 +113,7 @@ boolean Plugin_045(byte function, char *string)
    //==================================================================================
    display_Header();
    display_Name(PSTR("Auriol"));
-   char c_ID[2];
+   char c_ID[3];
    sprintf(c_ID, "%02X", rc);
    display_IDc(c_ID);
    display_TEMP(temperature);
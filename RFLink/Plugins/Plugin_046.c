@@ -54,17 +54,26 @@
 #define AURIOLV2_PULSEMAXMIN 1400 / RAWSIGNAL_SAMPLE_RATE
 #define AURIOLV2_PULSEMAX 2100 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_046_MINPULSES AURIOLV2_PULSECOUNT
+#define PLUGIN_046_MAXPULSES AURIOLV2_PULSECOUNT
+
 #ifdef PLUGIN_046
 #include "../4_Display.h"
+#include "../5_Plugin_Decode.h"
+
+// long pulse is a 1, pulses in between must be short
+const PulseCodeStruct AURIOLV2_Code PROGMEM = {2, 36, 2, AURIOLV2_PULSEMAXMIN, AURIOLV2_PULSEMIN, AURIOLV2_PULSEMINMAX, AURIOLV2_PULSEMAX, 1, AURIOLV2_MIDHI, 0};
 
 boolean Plugin_046(byte function, char *string)
 {
    if ((RawSignal.Number) != AURIOLV2_PULSECOUNT)
       return false;
+   if (RawFeatures.Max > AURIOLV2_PULSEMAX)
+      return false; // no pulse may be that long
 
    unsigned long bitstream1 = 0L; // holds first 6x4=24 bits
    unsigned long bitstream2 = 0L; // holds last  3x4=12 bits
-   byte bitcounter = 0;           // counts number of received bits (converted from pulses)
+   unsigned long bits[2];
    byte rc = 0;
    byte bat = 0;
    byte bat0 = 0;
@@ -75,41 +84,10 @@ boolean Plugin_046(byte function, char *string)
    //==================================================================================
    // Get all 36 bits
    //==================================================================================
-   for (byte x = 2; x < (AURIOLV2_PULSECOUNT); x += 2)
-   {
-      if (RawSignal.Pulses[x + 1] > AURIOLV2_MIDHI)
-         return false;
-      if (RawSignal.Pulses[x] > AURIOLV2_PULSEMAXMIN)
-      {
-         if (RawSignal.Pulses[x] > AURIOLV2_PULSEMAX)
-            return false;
-         if (bitcounter < 24)
-         {
-            bitstream1 <<= 1;
-            bitstream1 |= 0x1;
-            bitcounter++; // only need to count the first 24 bits
-         }
-         else
-         {
-            bitstream2 <<= 1;
-            bitstream2 |= 0x1;
-         }
-      }
-      else
-      {
-         if (RawSignal.Pulses[x] > AURIOLV2_PULSEMINMAX)
-            return false;
-         if (RawSignal.Pulses[x] < AURIOLV2_PULSEMIN)
-            return false;
-         if (bitcounter < 24)
-         {
-            bitstream1 <<= 1;
-            bitcounter++; // only need to count the first 10 bits
-         }
-         else
-            bitstream2 <<= 1;
-      }
-   }
+   if (!PulseCodeDecode(&AURIOLV2_Code, bits))
+      return false;
+   bitstream1 = bits[0] >> 8;                              // first 24 bits
+   bitstream2 = ((bits[0] & 0xFF) << 4) | (bits[1] & 0xF); // last 12 bits
    //==================================================================================
    // Perform a quick sanity check
    //==================================================================================
@@ -122,9 +100,7 @@ boolean Plugin_046(byte function, char *string)
    //==================================================================================
    unsigned long tmpval = (bitstream1 << 8) | (bitstream2 & 0xFF); // All but "1111" padded section
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen this RF packet recently
-   else
+   if (SignalRepeat(tmpval, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Now process the various sensor types
@@ -181,7 +157,7 @@ boolean Plugin_046(byte function, char *string)
       display_Name(PSTR("Auriol V2"));
    else
       display_Name(PSTR("Xiron"));
-   char c_ID[4];
+   char c_ID[5];
    sprintf(c_ID, "%02X%02X", rc, channel);
    display_IDc(c_ID);
    display_TEMP(temperature);
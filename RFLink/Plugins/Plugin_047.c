@@ -43,6 +43,9 @@
 #define AURIOLV4_PULSEMAXMIN 576 / RAWSIGNAL_SAMPLE_RATE
 #define AURIOLV4_PULSEMAX 768 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_047_MINPULSES (AURIOLV4_PULSECOUNT - 4)
+#define PLUGIN_047_MAXPULSES (AURIOLV4_PULSECOUNT + 2)
+
 #ifdef PLUGIN_047
 #include "../4_Display.h"
 #include "../7_Utils.h"
@@ -119,9 +122,7 @@ boolean Plugin_047(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (SignalRepeat(bitstream, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Perform checksum calculations
@@ -169,7 +170,7 @@ boolean Plugin_047(byte function, char *string)
    //==================================================================================
    display_Header();
    display_Name(PSTR("Auriol V4"));
-   char c_ID[4];
+   char c_ID[5];
    sprintf(c_ID, "%02X%02X", rc, channel);
    display_IDc(c_ID);
    display_TEMP(temperature);
@@ -34,6 +34,9 @@
 #define ALARMPIRV0_PULSESHORT 550 / RAWSIGNAL_SAMPLE_RATE
 #define ALARMPIRV0_PULSEMIN 250 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_060_MINPULSES ALARMPIRV0_PULSECOUNT
+#define PLUGIN_060_MAXPULSES ALARMPIRV0_PULSECOUNT
+
 #ifdef PLUGIN_060
 #include "../4_Display.h"
 
@@ -73,17 +76,10 @@ boolean Plugin_060(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 2000 < millis()))
-   {
-      // not seen the RF packet recently
-      if (bitstream == 0)
-         return false;
-   }
-   else
-   {
-      // already seen the RF packet recently
-      return true;
-   }
+   if (bitstream == 0)
+      return false;
+   if (SignalRepeat(bitstream, 2250))
+      return true; // already seen the RF packet recently
    //==================================================================================
    // Output
    // ----------------------------------
@@ -43,6 +43,9 @@
 #define ALARMPIRV1_PULSEMAX 1300 / RAWSIGNAL_SAMPLE_RATE
 #define ALARMPIRV1_PULSEMIN 150 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_061_MINPULSES ALARMPIRV1_PULSECOUNT
+#define PLUGIN_061_MAXPULSES ALARMPIRV1_PULSECOUNT
+
 #ifdef PLUGIN_061
 #include "../4_Display.h"
 
@@ -80,19 +83,10 @@ boolean Plugin_061(byte function, char *string)
    // Prevent repeating signals from showing up
    //==================================================================================
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 200) < millis()) || (SignalCRC != bitstream))
-   {
-      // not seen the RF packet recently
-      if (bitstream == 0)
-         return false;
-
-      SignalCRC = bitstream;
-   }
-   else
-   {
-      // already seen the RF packet recently
-      return true;
-   }
+   if (bitstream == 0)
+      return false;
+   if (SignalRepeat(bitstream, 450))
+      return true; // already seen the RF packet recently
    //==================================================================================
    bitstream2 = (bitstream) >> 16;
    if ((bitstream2) == 0xff)
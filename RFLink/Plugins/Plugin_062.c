@@ -30,6 +30,9 @@
 #define ALARMPIRV2_PULSEMAX 2000 / RAWSIGNAL_SAMPLE_RATE
 #define ALARMPIRV2_PULSEMIN 150 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_062_MINPULSES ALARMPIRV2_PULSECOUNT
+#define PLUGIN_062_MAXPULSES ALARMPIRV2_PULSECOUNT
+
 #ifdef PLUGIN_062
 #include "../4_Display.h"
 
@@ -66,19 +69,10 @@ boolean Plugin_062(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 200) < millis()) || (SignalCRC != bitstream))
-   {
-      // not seen the RF packet recently
-      if (bitstream == 0)
-         return false;
-
-      SignalCRC = bitstream;
-   }
-   else
-   {
-      // already seen the RF packet recently
-      return true;
-   }
+   if (bitstream == 0)
+      return false;
+   if (SignalRepeat(bitstream, 450))
+      return true; // already seen the RF packet recently
    //==================================================================================
    // Validity checks
    //==================================================================================
@@ -21,9 +21,15 @@
  \*********************************************************************************************/
 #define OREGON_PLA_PLUGIN_ID 063
 #define OREGON_PLA_PULSECOUNT 52
+#define OREGON_PLA_PULSEMID 600 / RAWSIGNAL_SAMPLE_RATE
+#define OREGON_PLA_PULSEEND 1600 / RAWSIGNAL_SAMPLE_RATE
+
+#define PLUGIN_063_MINPULSES (OREGON_PLA_PULSECOUNT - 2)
+#define PLUGIN_063_MAXPULSES OREGON_PLA_PULSECOUNT
 
 #ifdef PLUGIN_063
 #include "../4_Display.h"
+#include "../5_Plugin_Decode.h"
 
 boolean Plugin_063(byte function, char *string)
 {
@@ -40,49 +46,29 @@ boolean Plugin_063(byte function, char *string)
    //==================================================================================
    for (byte x = 1; x < 28; x += 2)
    {
-      if (RawSignal.Pulses[x] * RawSignal.Multiply > 600)
+      if (RawSignal.Pulses[x] > OREGON_PLA_PULSEMID)
          return false;
-      if (RawSignal.Pulses[x + 1] * RawSignal.Multiply > 600)
+      if (RawSignal.Pulses[x + 1] > OREGON_PLA_PULSEMID)
          return false;
    }
    //==================================================================================
    byte bits = 0;
-   byte rfbit = 1;
+   byte data[4];
+   int bitcounter;
    //==================================================================================
    // Get all 24 bits
    //==================================================================================
-   for (byte x = 29; x <= RawSignal.Number; x++)
-   {
-      if (RawSignal.Pulses[x] * RawSignal.Multiply > 600)
-      { // toggle bit value
-         if (RawSignal.Pulses[x] * RawSignal.Multiply > 1600)
-            break; // done..
-         rfbit = (~rfbit) & 1;
-         bitstream = (bitstream << 1) | rfbit;
-         if (RawSignal.Pulses[x + 1] * RawSignal.Multiply < 600)
-            x++;
-      }
-      else
-      {
-         bitstream = (bitstream << 1) | rfbit; // short pulse keep bit value
-         if (RawSignal.Pulses[x + 1] * RawSignal.Multiply < 600)
-            x++;
-      }
-   }
+   // long pulse toggles bit value, short pulse keeps it, a very long pulse ends the packet
+   bitcounter = PulseHalfDecode(29, RawSignal.Number, OREGON_PLA_PULSEMID, OREGON_PLA_PULSEEND, PULSEHALF_DIFF, data, 32);
+   if (bitcounter > 0)
+      bitstream = ((unsigned long)data[0] << 24 | (unsigned long)data[1] << 16 | (unsigned long)data[2] << 8 | data[3]) >> (32 - bitcounter);
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 2000 < millis()))
-   {
-      // not seen the RF packet recently
-      if (bitstream == 0)
-         return false;
-   }
-   else
-   {
-      // already seen the RF packet recently
-      return true;
-   }
+   if (bitstream == 0)
+      return false;
+   if (SignalRepeat(bitstream, 2250))
+      return true; // already seen the RF packet recently
    //==================================================================================
    // calculate sensor and channel
    bitstream = (bitstream) >> 4;
@@ -48,8 +48,15 @@
 #define SELECTPLUS_PULSEMID 650 / RAWSIGNAL_SAMPLE_RATE
 #define SELECTPLUS_PULSEMAX 2125 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_070_MINPULSES SELECTPLUS_PULSECOUNT
+#define PLUGIN_070_MAXPULSES SELECTPLUS_PULSECOUNT
+
 #ifdef PLUGIN_070
 #include "../4_Display.h"
+#include "../5_Plugin_Decode.h"
+
+// short/long or long/short pulse pairs, bit is the length of the first pulse
+const PulseCodeStruct SELECTPLUS_Code PROGMEM = {2, (SELECTPLUS_PULSECOUNT - 2) / 2, 2, SELECTPLUS_PULSEMID, 0, SELECTPLUS_PULSEMID, SELECTPLUS_PULSEMAX, 1, 0xFF, PULSECODE_MID_IS_LONG | PULSECODE_OPPOSITE};
 
 boolean Plugin_070(byte function, char *string)
 {
@@ -57,28 +64,14 @@ boolean Plugin_070(byte function, char *string)
         return false;
 
     unsigned long bitstream = 0L;
+    unsigned long bits[2];
     byte checksum = 0;
     //==================================================================================
     // Get all 18 bits
     //==================================================================================
-    for (byte x = 2; x < SELECTPLUS_PULSECOUNT; x = x + 2)
-    {
-        bitstream <<= 1; // Always shift
-        if (RawSignal.Pulses[x] < SELECTPLUS_PULSEMID)
-        {
-            if (RawSignal.Pulses[x + 1] < SELECTPLUS_PULSEMID)
-                return false; // invalid pulse sequence 10/01
-            // bitstream |= 0x0;
-        }
-        else
-        {
-            if (RawSignal.Pulses[x] > SELECTPLUS_PULSEMAX)
-                return false; // invalid pulse duration, pulse too long
-            if (RawSignal.Pulses[x + 1] > SELECTPLUS_PULSEMID)
-                return false; // invalid pulse sequence 10/01
-            bitstream |= 0x1;
-        }
-    }
+    if (!PulseCodeDecode(&SELECTPLUS_Code, bits))
+        return false; // invalid pulse sequence 10/01, or pulse too long
+    bitstream = bits[0];
    //==================================================================================
    // Perform a quick sanity check
    //==================================================================================
@@ -87,9 +80,7 @@ boolean Plugin_070(byte function, char *string)
     //==================================================================================
     // Prevent repeating signals from showing up
     //==================================================================================
-    if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-        SignalCRC = bitstream; // not seen the RF packet recently
-    else
+    if (SignalRepeat(bitstream, 1250))
         return true; // already seen the RF packet recently
     //==================================================================================
     // all bytes received, make sure checksum is okay
@@ -41,6 +41,9 @@
 #define PLIEGER_PULSEMID 700 / RAWSIGNAL_SAMPLE_RATE
 #define PLIEGER_PULSEMAX 1900 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_071_MINPULSES PLIEGER_PULSECOUNT
+#define PLUGIN_071_MAXPULSES PLIEGER_PULSECOUNT
+
 #ifdef PLUGIN_071
 #include "../4_Display.h"
 
@@ -83,9 +86,7 @@ boolean Plugin_071(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (SignalRepeat(bitstream, 1250))
       return true; // already seen the RF packet recently
    //==================================================================================
    id = ((bitstream >> 16) & 0xFFFF); // get 16 bits unique address
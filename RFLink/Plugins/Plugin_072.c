@@ -37,6 +37,9 @@
 #define BYRONLOW 350
 #define BYRONHIGH 675
 
+#define PLUGIN_072_MINPULSES BYRON_PULSECOUNT
+#define PLUGIN_072_MAXPULSES BYRON_PULSECOUNT
+
 #ifdef PLUGIN_072
 #include "../4_Display.h"
 
@@ -83,9 +86,7 @@ boolean Plugin_072(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (SignalRepeat(bitstream, 1250))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Output
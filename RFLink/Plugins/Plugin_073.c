@@ -36,6 +36,9 @@
 
 #define LENGTH_DEVIATION 300
 
+#define PLUGIN_073_MINPULSES DELTRONIC_PULSECOUNT
+#define PLUGIN_073_MAXPULSES DELTRONIC_PULSECOUNT
+
 #ifdef PLUGIN_073
 #include "../4_Display.h"
 
@@ -85,9 +88,7 @@ boolean Plugin_073(byte function, char *string)
     //==================================================================================
     // Prevent repeating signals from showing up
     //==================================================================================
-    if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-        SignalCRC = bitstream; // not seen the RF packet recently
-    else
+    if (SignalRepeat(bitstream, 1250))
         return true; // already seen the RF packet recently
     //==================================================================================
     // Output
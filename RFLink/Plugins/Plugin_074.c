@@ -38,8 +38,12 @@
 
 #define RL02_T 125 // 175 uS
 
+#define PLUGIN_074_MINPULSES ((RL02_CodeLength * 4) + 2)
+#define PLUGIN_074_MAXPULSES ((RL02_CodeLength * 4) + 2)
+
 #ifdef PLUGIN_074
 #include "../4_Display.h"
+#include "../5_Plugin_Decode.h"
 
 boolean Plugin_074(byte function, char *string)
 {
@@ -52,36 +56,27 @@ boolean Plugin_074(byte function, char *string)
     // Get all 12 bits
     //==================================================================================
     byte j = (RL02_T * 2) / RAWSIGNAL_SAMPLE_RATE;
+    byte symbols[RL02_CodeLength];
+    if (TristateDecode(1, RL02_CodeLength, j, symbols) & (1 << TRISTATE_ERROR))
+        return false;
     for (byte i = 0; i < RL02_CodeLength; i++)
     {
-
-        if (RawSignal.Pulses[4 * i + 1] < j && RawSignal.Pulses[4 * i + 2] > j && RawSignal.Pulses[4 * i + 3] < j && RawSignal.Pulses[4 * i + 4] > j)
-        {                    // 0101
-            bitstream >>= 1; // 0
-        }
-        else if (RawSignal.Pulses[4 * i + 1] < j && RawSignal.Pulses[4 * i + 2] > j && RawSignal.Pulses[4 * i + 3] > j && RawSignal.Pulses[4 * i + 4] < j)
+        bitstream >>= 1;
+        switch (symbols[i])
         {
-            bitstream >>= 1;                           // 0110
+        case TRISTATE_0: // 0101
+        case TRISTATE_1: // 1010
+            break;       // 0
+        case TRISTATE_F: // 0110
             bitstream |= (1 << (RL02_CodeLength - 1)); // 1
-        }
-        else if (RawSignal.Pulses[4 * i + 1] > j && RawSignal.Pulses[4 * i + 2] < j && RawSignal.Pulses[4 * i + 3] > j && RawSignal.Pulses[4 * i + 4] < j)
-        {                    // 1010
-            bitstream >>= 1; // 0
-        }
-        else
-        {
-            if (i == 0)
-            {
-                if (RawSignal.Pulses[4 * i + 1] > j && RawSignal.Pulses[4 * i + 2] > j && RawSignal.Pulses[4 * i + 3] < j && RawSignal.Pulses[4 * i + 4] > j)
-                {
-                    bitstream >>= 1;                           // 1101
-                    bitstream |= (1 << (RL02_CodeLength - 1)); // 1
-                }
-                else
-                    return false;
-            }
-            else
+            break;
+        case TRISTATE_0D: // 1101, first bit only
+            if (i != 0)
                 return false;
+            bitstream |= (1 << (RL02_CodeLength - 1)); // 1
+            break;
+        default:
+            return false;
         }
     }
     //==================================================================================
@@ -95,9 +90,7 @@ boolean Plugin_074(byte function, char *string)
     //==================================================================================
     // Prevent repeating signals from showing up
     //==================================================================================
-    if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-        SignalCRC = bitstream; // not seen the RF packet recently
-    else
+    if (SignalRepeat(bitstream, 1250))
         return true; // already seen the RF packet recently
     //==================================================================================
     // Output
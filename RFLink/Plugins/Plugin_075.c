@@ -40,6 +40,9 @@
 #define LIDL_PULSECOUNT 90   // type 0
 #define LIDL_PULSECOUNT2 114 // type 1
 
+#define PLUGIN_075_MINPULSES LIDL_PULSECOUNT
+#define PLUGIN_075_MAXPULSES LIDL_PULSECOUNT2
+
 #ifdef PLUGIN_075
 #include "../4_Display.h"
 
@@ -57,10 +60,12 @@ boolean Plugin_075(byte function, char *string)
    //==================================================================================
    if (RawSignal.Number == LIDL_PULSECOUNT)
    {
-      if (RawSignal.Pulses[1] * RawSignal.Multiply > 1000 && RawSignal.Pulses[2] * RawSignal.Multiply > 1000 &&
-          RawSignal.Pulses[3] * RawSignal.Multiply > 1000 && RawSignal.Pulses[4] * RawSignal.Multiply > 1000 &&
-          RawSignal.Pulses[5] * RawSignal.Multiply > 1000 && RawSignal.Pulses[6] * RawSignal.Multiply > 1000 &&
-          RawSignal.Pulses[7] * RawSignal.Multiply > 1000 && RawSignal.Pulses[8] * RawSignal.Multiply > 1000 && RawSignal.Pulses[9] * RawSignal.Multiply > 1000)
+      if (RawFeatures.Max <= PULSE_FLOOR(1000))
+         return false; // preamble pulses 2..9 are above 1000 uSec
+      if (RawSignal.Pulses[1] > PULSE_FLOOR(1000) && RawSignal.Pulses[2] > PULSE_FLOOR(1000) &&
+          RawSignal.Pulses[3] > PULSE_FLOOR(1000) && RawSignal.Pulses[4] > PULSE_FLOOR(1000) &&
+          RawSignal.Pulses[5] > PULSE_FLOOR(1000) && RawSignal.Pulses[6] > PULSE_FLOOR(1000) &&
+          RawSignal.Pulses[7] > PULSE_FLOOR(1000) && RawSignal.Pulses[8] > PULSE_FLOOR(1000) && RawSignal.Pulses[9] > PULSE_FLOOR(1000))
       {
          //
       }
@@ -72,7 +77,7 @@ boolean Plugin_075(byte function, char *string)
          if (bitcount < 28)
          {
             bitstream <<= 1; // Always shift
-            if (RawSignal.Pulses[x] * RawSignal.Multiply > 550)
+            if (RawSignal.Pulses[x] > PULSE_FLOOR(550))
             {
                // bitstream |= 0x0;
             }
@@ -85,7 +90,7 @@ boolean Plugin_075(byte function, char *string)
          else
          {
             bitstream2 <<= 1; // Always shift
-            if (RawSignal.Pulses[x] * RawSignal.Multiply > 550)
+            if (RawSignal.Pulses[x] > PULSE_FLOOR(550))
             {
                // bitstream2 |= 0x0;
             }
@@ -104,9 +109,9 @@ boolean Plugin_075(byte function, char *string)
       type = 1;
       for (byte x = 1; x < LIDL_PULSECOUNT2 - 1; x += 2)
       {
-         if (RawSignal.Pulses[x] * RawSignal.Multiply > 200)
+         if (RawSignal.Pulses[x] > PULSE_FLOOR(200))
          {
-            if (RawSignal.Pulses[x + 1] * RawSignal.Multiply > 200)
+            if (RawSignal.Pulses[x + 1] > PULSE_FLOOR(200))
                return false; // invalid pulse length
             if (bitcount > 23)
             {
@@ -120,7 +125,7 @@ boolean Plugin_075(byte function, char *string)
          }
          else
          {
-            if (RawSignal.Pulses[x + 1] * RawSignal.Multiply < 200)
+            if (RawSignal.Pulses[x + 1] < PULSE_CEIL(200))
                return false; // invalid pulse length
             if (bitcount > 23)
             {
@@ -152,9 +157,7 @@ boolean Plugin_075(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (SignalRepeat(bitstream, 1250))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Output
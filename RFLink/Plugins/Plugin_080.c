@@ -43,6 +43,9 @@
 #define FA20_PULSEMAXMIN 2000 / RAWSIGNAL_SAMPLE_RATE
 #define FA20_PULSEMAX 2800 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_080_MINPULSES FA20_PULSECOUNT
+#define PLUGIN_080_MAXPULSES FA20_PULSECOUNT
+
 #ifdef PLUGIN_080
 #include "../4_Display.h"
 
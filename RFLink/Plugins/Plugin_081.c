@@ -43,10 +43,13 @@
 #define MAXITROL1_PLUGIN_ID 081
 #define MAXITROL1_PULSECOUNT 46
 
-#define MAXITROL1_MID 550
+#define MAXITROL1_MID 550 / RAWSIGNAL_SAMPLE_RATE
 #define MAXITROL1_PULSEMINMAX 550 / RAWSIGNAL_SAMPLE_RATE
 #define MAXITROL1_PULSEMAX 900 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_081_MINPULSES MAXITROL1_PULSECOUNT
+#define PLUGIN_081_MAXPULSES MAXITROL1_PULSECOUNT
+
 #ifdef PLUGIN_081
 #include "../4_Display.h"
 
@@ -96,9 +99,7 @@ boolean Plugin_081(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (SignalRepeat(bitstream, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    command = (bitstream & 0x0F); // get address from pulses
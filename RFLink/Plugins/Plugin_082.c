@@ -43,10 +43,13 @@
 #define MAXITROL2_PLUGIN_ID 082
 #define MAXITROL2_PULSECOUNT 26
 
-#define MAXITROL2_MID 550
+#define MAXITROL2_MID 550 / RAWSIGNAL_SAMPLE_RATE
 #define MAXITROL2_PULSEMINMAX 550 / RAWSIGNAL_SAMPLE_RATE
 #define MAXITROL2_PULSEMAX 900 / RAWSIGNAL_SAMPLE_RATE
 
+#define PLUGIN_082_MINPULSES MAXITROL2_PULSECOUNT
+#define PLUGIN_082_MAXPULSES MAXITROL2_PULSECOUNT
+
 #ifdef PLUGIN_082
 #include "../4_Display.h"
 
@@ -96,9 +99,7 @@ boolean Plugin_082(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (SignalRepeat(bitstream, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    command = (bitstream & 0x0F); // get address from pulses
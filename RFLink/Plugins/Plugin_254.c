@@ -21,13 +21,15 @@
  \*********************************************************************************************/
 #define P254_PLUGIN_ID 254
 
+#define PLUGIN_254_MINPULSES 24
+#define PLUGIN_254_MAXPULSES RAW_BUFFER_SIZE
+
 #ifdef PLUGIN_254
+#include "../3_Serial.h"
 #include "../4_Display.h"
 
 boolean Plugin_254(byte function, char *string)
 {
-   int i;
-
    if ((RFUDebug == false) && (QRFUDebug == false)) // debug is on?
       return false;
 
@@ -41,22 +43,7 @@ boolean Plugin_254(byte function, char *string)
    display_Name(PSTR("DEBUG"));
    display_Footer();
    // ----------------------------------
-   Serial.print(F("20;XX;DEBUG;Pulses=")); // debug data
-   Serial.print(RawSignal.Number);         // print number of pulses
-   Serial.print(F(";Pulses(uSec)="));      // print pulse durations
-   // ----------------------------------
-   for (i = 1; i < RawSignal.Number + 1; i++)
-   {
-      if (QRFDebug == true)
-         Serial.printf("%02x", RawSignal.Pulses[i]);
-      else
-      {
-         Serial.print(RawSignal.Pulses[i] * RAWSIGNAL_SAMPLE_RATE);
-         if (i < RawSignal.Number)
-            Serial.write(',');
-      }
-   }
-   Serial.print(F(";\r\n"));
+   SerialPulses(); // debug data
    // ----------------------------------
    RawSignal.Number = 0; // Last plugin, kill packet
    return true;          // stop processing
@@ -11,7 +11,7 @@
 // Here are all plugins listed that are supported and used after compilation.
 // When needed additional plugins can be added or selected plugins can be enabled/disabled.
 //
-// BEWARE OF THE PLUGIN_MAX setting!!       TX: 51      RX: 24
+// New receive plugins must also be listed in Plugin_table[] (5_Plugin.cpp), which only holds the enabled ones.
 // ****************************************************************************************************************************************
 // Translation Plugin for oversized packets due to their breaks/pause being too short between packets
 // Used for Flamingo FA500R and various others, do NOT exclude this plugin.
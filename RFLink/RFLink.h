@@ -16,18 +16,79 @@
 #define RAW_BUFFER_SIZE 292             // 292        // Maximum number of pulses that is received in one go.
 #define RAWSIGNAL_SAMPLE_RATE 32        // 32         // =8 bits. Sample width / resolution in uSec for raw RF pulses.
 #define SIGNAL_SEEK_TIMEOUT_MS 25       // 25         // After this time in mSec. RF signal will be considered absent.
+#ifndef SIGNAL_MIN_PREAMBLE_US // may be set by build flags, e.g. for host simulation sweeps
 #define SIGNAL_MIN_PREAMBLE_US 3000     // 3000       //
+#endif
 #define MIN_PULSE_LENGTH_US 25          // 25         // Pulses shorter than this value in uSec. will be seen as garbage and not taken as actual pulses.
+#ifndef SIGNAL_END_TIMEOUT_US // may be set by build flags, e.g. for host simulation sweeps
 #define SIGNAL_END_TIMEOUT_US 5000      // 4500       // After this time in uSec. the RF signal will be considered to have stopped.
+#endif
 #define SIGNAL_REPEAT_TIME_MS 250       // 500        // Time in mSec. in which the same RF signal should not be accepted again. Filters out retransmits.
+#if (defined(ESP32) || defined(ESP8266) || defined(RF_HOST_SIM))
+#define REPEAT_CACHE_SIZE 8             // 8          // Number of recently decoded packets remembered to filter out their retransmits.
+#else
+#define REPEAT_CACHE_SIZE 4             // 4          // 11 bytes each
+#endif
 #define TRANSMITTER_STABLE_DELAY_US 500 // 500        // delay to let the transmitter become stable (Note: Aurel RTX MID needs 500µS/0,5ms).
 #define SCAN_HIGH_TIME_MS 50            // 50         // time interval in ms. fast processing for background tasks
 #define FOCUS_TIME_MS 50                // 50         // Duration in mSec. that, after receiving serial data from USB only the serial port is checked.
-#define PLUGIN_MAX 55                   // 55         // Maximum number of Receive plugins
+#if (defined(ESP32) || defined(ESP8266) || defined(RF_HOST_SIM))
+#define PLUGIN_DISPATCH_TABLE           //            // Lookup candidate plugins by pulse count instead of scanning all of them
+#define PLUGIN_DISPATCH_SIZE 1536       // 1536       // Size of the pulse count => plugins table
+// #define PLUGIN_ADAPTIVE_ORDER         //            // Try first the plugins that decoded most frames of the same length recently
+#define PLUGIN_ADAPTIVE_DECAY 256       // 256        // Number of decoded frames after which the decode counts used for ordering are halved
+#define SIGNAL_COMBINE                  //            // Majority vote undecoded repeats of a frame, pulse by pulse, and decode the result
+#define SIGNAL_COMBINE_FRAMES 4         // 4          // Number of undecoded frames kept for SIGNAL_COMBINE (about 300 bytes each)
+#define SIGNAL_COMBINE_MS 1000          // 1000       // Time in mSec. in which undecoded frames can be combined with a repeat
+#define SIGNAL_COMBINE_DIFF 8           // 8          // Max number of pulses on the other side of short/long for two frames to be repeats
+#define SIGNAL_MEMO                     //            // Drop the repeats of a frame just decoded on the fingerprint of its pulses, before any plugin runs
+#define SIGNAL_MEMO_FRAMES 4            // 4          // Number of fingerprints kept for SIGNAL_MEMO
+#endif
 #define PLUGIN_TX_MAX 0                 // 26         // Maximum number of Transmit plugins
 #define INPUT_COMMAND_SIZE 60           // 60         // Maximum number of characters that a command via serial can be.
 #define PRINT_BUFFER_SIZE 90            // 60         // Maximum number of characters that a command should print in one go via the print buffer.
 
+// RF capture mode
+// #define RF_ISR_CAPTURE                // Timestamp RF edges in an interrupt instead of polling the RX pin (ESP only)
+#define EDGE_RING_SIZE 1024             // 1024       // Number of edge timestamps buffered between interrupt and frame assembler. Must be a power of 2.
+#if defined(RF_ISR_CAPTURE) && (defined(ESP32) || defined(ESP8266) || defined(RF_HOST_SIM))
+#define RAW_SIGNAL_POOL 4               // 4          // Number of RawSignal frames, so that frames captured in background wait while the current one is decoded.
+#else
+#define RAW_SIGNAL_POOL 1               // 1          // Polling captures a frame only between decodes, one frame is enough (and all AVR has RAM for).
+#endif
+
+// Plugin enable / disable (10;PLUGINnnn=ON; / 10;PLUGINnnn=OFF; over Serial or MQTT)
+#define PLUGIN_STATE_EEPROM             //            // Keep the enabled / disabled plugins in EEPROM across reboots
+#define PLUGIN_EEPROM_ADDR 0            // 0          // First EEPROM byte used (33 bytes)
+
+// Flex decoders, defined at runtime for devices without a plugin (10;FLEXn=...; over Serial or MQTT, see 5_Plugin_Flex.h)
+#if (defined(ESP32) || defined(ESP8266) || defined(RF_HOST_SIM))
+#define FLEX_DECODER                    //            // Offer the frames no plugin could decode to the flex decoders
+#define FLEX_SLOTS 4                    // 4          // Number of flex decoders
+#define FLEX_EEPROM_ADDR 40             // 40         // First EEPROM byte used (1 + 16 bytes per flex decoder)
+#endif
+#define EEPROM_RESERVED 128             // 128        // EEPROM bytes emulated in flash on ESP, must hold all of the above
+
+// Change-only publishing: sensor readings equal to the last ones published for the device are dropped
+#if (defined(ESP32) || defined(ESP8266) || defined(RF_HOST_SIM))
+// #define PUBLISH_CHANGES              //            // Publish sensor readings only when they change, or as a heartbeat (10;PUBLISH; shows the counters)
+#define PUBLISH_DEVICES 64              // 64         // Number of devices whose last published readings are kept (32 bytes each)
+#define PUBLISH_HEARTBEAT_MS 600000     // 600000     // Time in mSec. after which unchanged readings are published anyway
+#define PUBLISH_DELTA_TEMP 2            // 2          // Temperature change, in tenths of degree, published at once (also WINCHL, WINTMP)
+#define PUBLISH_DELTA_HUM 2             // 2          // Humidity change, in %, published at once. Other readings: any change
+#endif
+
+// Outbound event queue: decode does not wait for Serial, MQTT and OLED
+#if (defined(ESP32) || defined(ESP8266) || defined(RF_HOST_SIM))
+#define EVENT_QUEUE                     //            // Queue the events, each sink sends them at its own pace between frames (10;QUEUE; shows the counters)
+#define EVENT_QUEUE_SIZE 8              // 8          // Number of events queued (about 180 bytes each), the oldest is dropped when full. Must be a power of 2.
+#define EVENT_QUEUE_SERIAL_ROOM 96      // 96         // Free bytes in the Serial TX buffer before the next event is written, so that a 20;xx; line never waits for the UART
+#endif
+
+// Plugin statistics
+// #define PLUGIN_STATS                  // Count calls, accepts and CPU cycles of each receive plugin (10;STATS; reports them at once)
+#define PLUGIN_STATS_MS 60000           // 60000      // Time in mSec. between two statistics reports (counters restart after each report)
+
 /*
 #define VALUE_PAIR                     44
 #define VALUE_ALLOFF                   55
@@ -91,9 +152,11 @@
 
 // MQTT messages
 #define SERIAL_ENABLED    // Send RFLink messages over Serial
+// #define SERIAL_BINARY   // Binary frames instead of 20;xx;... lines on Serial after 10;BINARY=ON; (see 3_Serial.h)
 #define MQTT_ENABLED      // Send RFLink messages over MQTT
 #define MQTT_LOOP_MS 7500 // MQTTClient.loop(); call period (in mSec)
 // #define MQTT_RETAINED   // Retained option
+// #define MQTT_JSON       // Decoded events as JSON on MQTT_TOPIC_JSON/<name>/<ID>[/<SWITCH>] instead of MQTT_TOPIC_OUT
 
 // Debug default
 #define RFDebug_0 false   // debug RF signals with plugin 001 (no decode)
@@ -19,6 +19,7 @@
 #include <Arduino.h>
 #include "RFLink.h"
 #include "2_Signal.h"
+#include "3_Serial.h"
 #include "4_Display.h"
 #include "5_Plugin.h"
 #if (defined(__AVR_ATmega328P__) || defined(__AVR_ATmega2560__))
@@ -29,6 +30,9 @@
 #ifdef OLED_ENABLED
 #include "8_OLED.h"
 #endif
+#if (defined(PLUGIN_STATE_EEPROM) || defined(FLEX_DECODER)) && (defined(ESP32) || defined(ESP8266))
+#include <EEPROM.h>
+#endif
 //****************************************************************************************************************************************
 
 #if (defined(__AVR_ATmega328P__) || defined(__AVR_ATmega2560__))
@@ -36,6 +40,12 @@ void (*Reboot)(void) = 0; // reset function on adress 0.
 #endif
 
 void sendMsg(); // See at bottom
+#ifdef EVENT_QUEUE
+void sendQueue(); // See at bottom
+#endif
+#ifdef PLUGIN_STATS
+void sendStats(); // See at bottom
+#endif
 
 void setup()
 {
@@ -84,6 +94,7 @@ void setup()
   display_Header();
   display_Splash();
   display_Footer();
+  EventText();
 #ifdef SERIAL_ENABLED
   Serial.print(pbuffer);
 #endif
@@ -93,28 +104,71 @@ void setup()
 #ifdef OLED_ENABLED
   splash_OLED();
 #endif
-  pbuffer[0] = 0;
+  EventClear();
 
+#if (defined(PLUGIN_STATE_EEPROM) || defined(FLEX_DECODER)) && (defined(ESP32) || defined(ESP8266))
+  EEPROM.begin(EEPROM_RESERVED); // emulated in flash, read by PluginInit()
+#endif
+  InitFrames();
   PluginInit();
   delay(100);
+#if defined(RF_ISR_CAPTURE) && (defined(ESP32) || defined(ESP8266))
+  setup_RF_ISR(); // Start timestamping RF edges in background
+#endif
 }
 
 void loop()
 {
 #if defined(MQTT_ENABLED) && (defined(ESP32) || defined(ESP8266))
   checkMQTTloop();
+  sendMsg(); // answer to MQTT command, if any
 #endif
 
+  if (CheckSerial())
+    sendMsg();
+
   if (ScanEvent())
+  {
+#ifdef PUBLISH_CHANGES
+    ReadingPublish(); // unchanged sensor readings are dropped
+#endif
     sendMsg();
+  }
+#ifdef EVENT_QUEUE
+  // RX gap: either a frame was just decoded, its repeats are suppressed anyway,
+  // or nothing was received for SCAN_HIGH_TIME_MS
+  sendQueue();
+#endif
+
+#ifdef PLUGIN_STATS
+  static unsigned long StatsTimer = millis();
+
+  if ((millis() - StatsTimer >= PLUGIN_STATS_MS) || PluginStatsRequest)
+  {
+    sendStats();
+    StatsTimer = millis();
+    PluginStatsRequest = false;
+  }
+#endif
 }
 
 void sendMsg()
 {
-  if (pbuffer[0] != 0)
+  if (Event.Complete)
   {
+#ifdef EVENT_QUEUE
+    EventQueue(); // sent by sendQueue()
+#else
+#if defined(SERIAL_ENABLED) || (defined(MQTT_ENABLED) && (defined(ESP32) || defined(ESP8266)))
+    EventText(); // 20;xx;... line
+#endif
 #ifdef SERIAL_ENABLED
-    Serial.print(pbuffer);
+#ifdef SERIAL_BINARY
+    if (SerialBinary)
+      SerialWriteEvent();
+    else
+#endif
+      Serial.print(pbuffer);
 #endif
 #if defined(MQTT_ENABLED) && (defined(ESP32) || defined(ESP8266))
     publishMsg();
@@ -122,7 +176,72 @@ void sendMsg()
 #ifdef OLED_ENABLED
     print_OLED();
 #endif
-    pbuffer[0] = 0;
+    EventClear();
+#endif // EVENT_QUEUE
+  }
+}
+
+#ifdef EVENT_QUEUE
+// Each sink takes the queued events at its own pace, none of them waits for another
+void sendQueue()
+{
+#ifdef SERIAL_ENABLED
+  while ((Serial.availableForWrite() >= EVENT_QUEUE_SERIAL_ROOM) && EventFetch(EVENT_SINK_SERIAL))
+  {
+#ifdef SERIAL_BINARY
+    if (SerialBinary)
+      SerialWriteEvent();
+    else
+#endif
+    {
+      EventText(); // 20;xx;... line
+      Serial.print(pbuffer);
+    }
+    EventSent(EVENT_SINK_SERIAL);
+  }
+#endif
+#if defined(MQTT_ENABLED) && (defined(ESP32) || defined(ESP8266))
+  if (EventFetch(EVENT_SINK_MQTT))
+  { // one round-trip per pass, kept while the broker is away
+    EventText();
+    if (publishMsg())
+      EventSent(EVENT_SINK_MQTT);
+  }
+#endif
+#ifdef OLED_ENABLED
+  if (EventFetch(EVENT_SINK_OLED))
+  { // one I2C update per pass
+    print_OLED();
+    EventSent(EVENT_SINK_OLED);
+  }
+#endif
+  EventClear();
+}
+#endif
+
+#ifdef PLUGIN_STATS
+void sendStats()
+{
+  for (byte x = 0; x < Plugin_count; x++)
+  {
+    if (PluginStatsMsg(x))
+    {
+      EventText();
+#ifdef SERIAL_ENABLED
+#ifdef SERIAL_BINARY
+      if (SerialBinary)
+        SerialWriteEvent();
+      else
+#endif
+        Serial.print(pbuffer);
+#endif
+#if defined(MQTT_ENABLED) && (defined(ESP32) || defined(ESP8266))
+      publishStats();
+#endif
+      EventClear();
+    }
   }
+  PluginStatsReset();
 }
+#endif
 /*********************************************************************************************/
@@ -0,0 +1,147 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Host side of the Arduino core used by the tests and benchmarks.
+// millis() and micros() follow the virtual clock of 2_Signal_Sim.cpp, so that
+// time only moves when the capture code polls or a test calls Sim_Advance().
+// Serial goes to stdout, or to a string (Host.h). The test helpers are at the end.
+
+#include <Arduino.h>
+#include <EEPROM.h>
+#include <time.h>
+#include "Host.h"
+#include "2_Signal.h"
+#include "2_Signal_Sim.h"
+#include "4_Display.h"
+#include "5_Plugin.h"
+
+HardwareSerial Serial;
+EspClass ESP;
+EEPROMClass EEPROM;
+
+unsigned long millis(void) { return SimClock_us / 1000UL; }
+unsigned long micros(void) { return SimClock_us; }
+void delay(unsigned long Duration_ms) { Sim_Advance(Duration_ms * 1000UL); }
+void delayMicroseconds(unsigned int Duration_us) { Sim_Advance(Duration_us); }
+void yield(void) {}
+int digitalRead(uint8_t) { return LOW; }
+void digitalWrite(uint8_t, uint8_t) {}
+void pinMode(uint8_t, uint8_t) {}
+void noInterrupts(void) {}
+void interrupts(void) {}
+int digitalPinToInterrupt(int Pin) { return Pin; }
+void attachInterrupt(int, void (*)(void), int) {}
+void detachInterrupt(int) {}
+
+// 80 MHz cycle counter on host time, as for RF_CYCLES()
+uint32_t EspClass::getCycleCount(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t)((unsigned long long)now.tv_sec * 80000000ULL + now.tv_nsec * 2ULL / 25ULL);
+}
+
+// Serial output goes to stdout, or to the end of *SerialCapture when a test sets it
+std::string *SerialCapture = NULL;
+
+static size_t HostWrite(const void *Data, size_t Length)
+{
+  if (SerialCapture != NULL)
+    SerialCapture->append((const char *)Data, Length);
+  else
+    fwrite(Data, 1, Length, stdout);
+  return Length;
+}
+
+static size_t HostPrint(const char *Format, ...)
+{
+  char Text[512];
+  va_list Args;
+  int Length;
+
+  va_start(Args, Format);
+  Length = vsnprintf(Text, sizeof(Text), Format, Args);
+  va_end(Args);
+  return HostWrite(Text, (Length < (int)sizeof(Text)) ? Length : sizeof(Text) - 1);
+}
+
+void HardwareSerial::begin(long) {}
+int HardwareSerial::available(void) { return 0; }
+int HardwareSerial::read(void) { return -1; }
+int HardwareSerial::availableForWrite(void) { return 128; }
+void HardwareSerial::flush(void) { fflush(stdout); }
+size_t HardwareSerial::write(uint8_t c) { return HostWrite(&c, 1); }
+size_t HardwareSerial::write(const uint8_t *Data, size_t Length) { return HostWrite(Data, Length); }
+size_t HardwareSerial::print(const char *s) { return HostWrite(s, strlen(s)); }
+size_t HardwareSerial::print(const __FlashStringHelper *s) { return print((const char *)s); }
+size_t HardwareSerial::print(char c) { return HostWrite(&c, 1); }
+size_t HardwareSerial::print(int v) { return HostPrint("%d", v); }
+size_t HardwareSerial::print(unsigned int v) { return HostPrint("%u", v); }
+size_t HardwareSerial::print(long v) { return HostPrint("%ld", v); }
+size_t HardwareSerial::print(unsigned long v) { return HostPrint("%lu", v); }
+size_t HardwareSerial::println(void) { return HostWrite("\r\n", 2); }
+size_t HardwareSerial::println(const char *s) { return print(s) + println(); }
+size_t HardwareSerial::println(const __FlashStringHelper *s) { return print(s) + println(); }
+size_t HardwareSerial::println(int v) { return print(v) + println(); }
+size_t HardwareSerial::println(unsigned long v) { return print(v) + println(); }
+
+size_t HardwareSerial::printf(const char *Format, ...)
+{
+  char Text[512];
+  va_list Args;
+  int Length;
+
+  va_start(Args, Format);
+  Length = vsnprintf(Text, sizeof(Text), Format, Args);
+  va_end(Args);
+  return HostWrite(Text, (Length < (int)sizeof(Text)) ? Length : sizeof(Text) - 1);
+}
+
+// ***********************************************************************************
+// Test helpers
+// ***********************************************************************************
+int Failed = 0;
+
+void Load(const int *Pulses_us, int Count, unsigned long Time)
+{
+  RawSignal.Number = Count;
+  RawSignal.Multiply = RAWSIGNAL_SAMPLE_RATE;
+  RawSignal.Time = Time;
+  RawSignal.Pulses[0] = 0;
+  for (int x = 0; x < Count; x++)
+    RawSignal.Pulses[x + 1] = Pulses_us[x] / RAWSIGNAL_SAMPLE_RATE;
+}
+
+byte Decode(void)
+{
+  EventClear();
+  if (PluginRXCall(0, 0) && Event.Complete)
+    return Event.Protocol;
+  return 0;
+}
+
+void Check(const char *What, bool Good)
+{
+  printf("%-40s %s\n", What, Good ? "ok" : "FAIL");
+  if (!Good)
+    Failed++;
+}
+
+void Check(const char *What, byte Protocol, byte Expected)
+{
+  printf("%-40s decoded by %3d, expected %3d\n", What, Protocol, Expected);
+  if (Protocol != Expected)
+    Failed++;
+}
+
+int Done(void)
+{
+  if (Failed)
+    printf("FAIL\n");
+  return Failed;
+}
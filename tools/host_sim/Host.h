@@ -0,0 +1,25 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef Host_h
+#define Host_h
+
+#include <Arduino.h>
+#include <string>
+
+// When not NULL, Serial output is appended here instead of going to stdout
+extern std::string *SerialCapture;
+
+// Test helpers
+extern int Failed;                                              // checks that failed so far
+void Load(const int *Pulses_us, int Count, unsigned long Time); // RawSignal from pulse lengths in uSec
+byte Decode(void);                                              // PluginRXCall(), Protocol of the event sent or 0
+void Check(const char *What, bool Good);
+void Check(const char *What, byte Protocol, byte Expected); // Protocol from Decode()
+int Done(void);                                             // prints FAIL when a check failed, returns Failed
+
+#endif // Host_h
@@ -0,0 +1,79 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Dispatch benchmark (PLUGIN_STATS): 20000 frames through PluginRXCall(), 70% Auriol V2
+// sensor frames, the rest noise of various lengths. Prints the frames decoded and the
+// plugins tried per frame. bench_dispatch_adaptive is the same with PLUGIN_ADAPTIVE_ORDER,
+// both must decode the same frames.
+
+#include <Arduino.h>
+#include "2_Signal.h"
+#include "5_Plugin.h"
+#include "4_Display.h"
+
+// Auriol V2: 36 bits on the even pulses, 800 uSec is a 0 and 1750 uSec a 1, odd pulses 480 uSec
+static void Auriol(unsigned long Code, int Temperature)
+{
+  unsigned long Bits1 = ((Code & 0xFF) << 16) | (1UL << 15) | (Temperature & 0xFFF);
+  unsigned long Bits2 = 0xF00;
+  int x = 2;
+
+  RawSignal.Number = 74;
+  RawSignal.Multiply = RAWSIGNAL_SAMPLE_RATE;
+  RawSignal.Pulses[1] = 15;
+  for (int b = 23; b >= 0; b--, x += 2)
+  {
+    RawSignal.Pulses[x] = ((Bits1 >> b) & 1) ? 54 : 25;
+    RawSignal.Pulses[x + 1] = 15;
+  }
+  for (int b = 11; b >= 0; b--, x += 2)
+  {
+    RawSignal.Pulses[x] = ((Bits2 >> b) & 1) ? 54 : 25;
+    RawSignal.Pulses[x + 1] = 15;
+  }
+}
+
+static void Noise(void)
+{
+  static const int Lengths[] = {50, 74, 132, 26};
+
+  RawSignal.Number = Lengths[rand() % 4];
+  RawSignal.Multiply = RAWSIGNAL_SAMPLE_RATE;
+  for (int x = 1; x <= RawSignal.Number; x++)
+    RawSignal.Pulses[x] = 3 + rand() % 60;
+}
+
+int main(void)
+{
+  unsigned long Frames = 0;
+  unsigned long Decoded = 0;
+  unsigned long Calls = 0;
+
+  InitFrames();
+  PluginInit();
+  srand(1);
+  for (int f = 0; f < 20000; f++, Frames++)
+  {
+    if (rand() % 10 < 7)
+      Auriol(rand(), 200 + rand() % 50);
+    else
+      Noise();
+    RawSignal.Time = f * 1000UL;
+    if (PluginRXCall(0, 0))
+      Decoded++;
+    EventClear();
+  }
+  for (byte x = 0; x < Plugin_count; x++)
+    Calls += Plugin_stats[x].calls;
+#ifdef PLUGIN_ADAPTIVE_ORDER
+  printf("adaptive order: ");
+#else
+  printf("fixed order:    ");
+#endif
+  printf("%lu frames, %lu decoded, %.2f plugins tried per frame\n", Frames, Decoded, (double)Calls / Frames);
+  return 0;
+}
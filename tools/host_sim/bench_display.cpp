@@ -0,0 +1,55 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Message benchmark: a typical 8-field weather station message (Header, Name, ID, TEMP, HUM,
+// BARO, WINSP, WINDIR, RAIN, BAT, Footer) built 2000000 times, then formatted into pbuffer.
+// Trees from before the typed event fields format in the display_* functions themselves.
+
+#include <Arduino.h>
+#include <time.h>
+#include "4_Display.h"
+
+#define BENCH_MESSAGES 2000000L
+
+volatile unsigned long Sum; // keeps the loop from being optimized out
+
+static double Now(void)
+{
+  timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+int main(void)
+{
+  double t0 = Now();
+
+  for (long i = 0; i < BENCH_MESSAGES; i++)
+  {
+    pbuffer[0] = 0;
+    display_Header();
+    display_Name(PSTR("Oregon"));
+    display_IDn(0x1A2B + (i & 7), 4);
+    display_TEMP(215 + (i & 15));
+    display_HUM(55, HUM_HEX);
+    display_BARO(1013);
+    display_WINSP(123);
+    display_WINDIR(i & 15);
+    display_RAIN(0x8d);
+    display_BAT(true);
+    display_Footer();
+#ifdef EVENT_FIELDS
+    EventText();
+#endif
+    Sum += pbuffer[20];
+  }
+
+  printf("%s", pbuffer);
+  printf("%.0f ns/message\n", (Now() - t0) / BENCH_MESSAGES);
+  return 0;
+}
@@ -0,0 +1,91 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Plugin benchmark: 2000 random frames per plugin (009, 010, 011, 012, 044, 063, 075), within
+// its pulse count range, two pulse lengths plus outliers. Each plugin is called directly and
+// timed over 200 rounds. With "dump", each frame is run once and the result printed instead,
+// to diff the decodes of two trees (make build/bench_plugins RFLINK=<tree>).
+
+#include <Arduino.h>
+#include <time.h>
+#include "2_Signal.h"
+#include "5_Plugin.h"
+#include "4_Display.h"
+
+#define BENCH_FRAMES 2000
+#define BENCH_ROUNDS 200
+
+static const byte Ids[] = {9, 10, 11, 12, 44, 63, 75};
+static byte Frames[BENCH_FRAMES][RAW_BUFFER_SIZE + 2];
+static int Numbers[BENCH_FRAMES];
+
+static double Now(void)
+{
+  timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+int main(int argc, char **argv)
+{
+  boolean Dump = (argc > 1) && (strcmp(argv[1], "dump") == 0);
+
+  InitFrames();
+  PluginInit();
+  srand(13);
+  for (unsigned int k = 0; k < sizeof(Ids); k++)
+  {
+    byte x = PluginIndex(Ids[k]);
+    int Low = Plugin_minpulses(x);
+    int High = Plugin_maxpulses(x);
+    unsigned long Accepted = 0;
+    double ns = 0;
+
+    for (int f = 0; f < BENCH_FRAMES; f++)
+    {
+      int Short = 3 + rand() % 40;
+      int Long = 3 + rand() % 60;
+
+      Numbers[f] = Low + rand() % (High - Low + 1);
+      for (int i = 0; i <= Numbers[f] + 1; i++)
+      {
+        int r = rand() % 100;
+        Frames[f][i] = (r < 45) ? Short + rand() % 3 : (r < 90) ? Long + rand() % 3 : rand() % 256;
+      }
+      Frames[f][0] = 0;
+    }
+
+    for (int r = 0; r < (Dump ? 1 : BENCH_ROUNDS); r++)
+      for (int f = 0; f < BENCH_FRAMES; f++)
+      {
+        memcpy(RawSignal.Pulses, Frames[f], Numbers[f] + 2);
+        RawSignal.Number = Numbers[f];
+        RawSignal.Multiply = RAWSIGNAL_SAMPLE_RATE;
+        RawSignal.Time = (r * BENCH_FRAMES + f) * 1000UL;
+        PulseFeaturesCompute();
+        SignalHash = x;
+        EventClear();
+
+        double t0 = Now();
+        boolean ok = Plugin_ptr(x)(0, 0);
+        ns += Now() - t0;
+        Accepted += ok;
+
+        if (Dump)
+        {
+          pbuffer[0] = 0;
+          if (Event.Complete)
+            EventText();
+          printf("%03d %d %d %d %s%s", Ids[k], f, ok, RawSignal.Number, pbuffer, Event.Complete ? "" : "\n");
+        }
+      }
+    if (!Dump)
+      printf("plugin %03d: %.1f ns/frame (accepted %lu)\n", Ids[k], ns / (BENCH_ROUNDS * (double)BENCH_FRAMES), Accepted);
+  }
+  return 0;
+}
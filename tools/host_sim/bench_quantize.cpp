@@ -0,0 +1,98 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// PulseQuantize() benchmark: 1000 random frames of RAW_BUFFER_SIZE pulses, quantized 200
+// times each by a per-pulse reference loop and by PulseQuantize(), the cost of copying the
+// frame taken out. The maps must match. bench_quantize uses the SSE2 path of the host,
+// bench_quantize_swar is built without it and runs the ESP8266/ESP32 path.
+
+#include <Arduino.h>
+#include <time.h>
+#include "2_Signal.h"
+
+#define BENCH_FRAMES 1000
+#define BENCH_ROUNDS 200
+#define BENCH_MID 20
+
+extern int PulseMap_mid;
+
+static byte Frames[BENCH_FRAMES][RAW_BUFFER_SIZE + 2];
+static uint32_t Reference[PULSE_MAP_WORDS + 1];
+volatile unsigned long Sum; // keeps the loops from being optimized out
+
+static double Now(void)
+{
+  timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+// One pulse at a time, as PulseQuantize() does on AVR
+__attribute__((noinline)) static void Quantize(byte Mid)
+{
+  memset(Reference, 0, sizeof(Reference));
+  for (int x = 0; x <= RawSignal.Number; x++)
+    Reference[x >> 5] |= (uint32_t)(RawSignal.Pulses[x] > Mid) << (31 - (x & 31));
+}
+
+int main(void)
+{
+  unsigned long Mismatches = 0;
+
+  InitFrames();
+  srand(3);
+  for (int f = 0; f < BENCH_FRAMES; f++)
+    for (int i = 0; i <= RAW_BUFFER_SIZE; i++)
+      Frames[f][i] = rand() % 64;
+  RawSignal.Number = RAW_BUFFER_SIZE;
+
+  for (int f = 0; f < BENCH_FRAMES; f++)
+  {
+    memcpy(RawSignal.Pulses, Frames[f], RAW_BUFFER_SIZE + 1);
+    Quantize(BENCH_MID);
+    PulseMap_mid = -1;
+    if (memcmp(Reference, PulseQuantize(BENCH_MID), PULSE_MAP_WORDS * sizeof(uint32_t)) != 0)
+      Mismatches++;
+  }
+
+  double t0 = Now();
+  for (int r = 0; r < BENCH_ROUNDS; r++)
+    for (int f = 0; f < BENCH_FRAMES; f++)
+    {
+      memcpy(RawSignal.Pulses, Frames[f], RAW_BUFFER_SIZE + 1);
+      Quantize(BENCH_MID);
+      Sum += Reference[3];
+    }
+  double t1 = Now();
+  for (int r = 0; r < BENCH_ROUNDS; r++)
+    for (int f = 0; f < BENCH_FRAMES; f++)
+    {
+      memcpy(RawSignal.Pulses, Frames[f], RAW_BUFFER_SIZE + 1);
+      PulseMap_mid = -1; // new frame
+      Sum += PulseQuantize(BENCH_MID)[3];
+    }
+  double t2 = Now();
+  for (int r = 0; r < BENCH_ROUNDS; r++)
+    for (int f = 0; f < BENCH_FRAMES; f++)
+    {
+      memcpy(RawSignal.Pulses, Frames[f], RAW_BUFFER_SIZE + 1);
+      Sum += RawSignal.Pulses[3];
+    }
+  double t3 = Now();
+
+  double Copy = (t3 - t2) / (BENCH_ROUNDS * (double)BENCH_FRAMES);
+#ifdef __SSE2__
+  printf("SSE2, ");
+#else
+  printf("SWAR, ");
+#endif
+  printf("%d pulses: per-pulse loop %.0f ns, PulseQuantize %.0f ns, %lu mismatches\n", RAW_BUFFER_SIZE,
+         (t1 - t0) / (BENCH_ROUNDS * (double)BENCH_FRAMES) - Copy, (t2 - t1) / (BENCH_ROUNDS * (double)BENCH_FRAMES) - Copy,
+         Mismatches);
+  return Mismatches != 0;
+}
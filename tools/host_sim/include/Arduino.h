@@ -0,0 +1,150 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Host stand-in for the Arduino core, just what the RFLink sources use.
+// PROGMEM is plain RAM and the *_P functions are their RAM versions.
+// Clocks and pins are in Host.cpp, Serial writes to stdout.
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <stdarg.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PROGMEM
+#define PSTR(s) (s)
+class __FlashStringHelper;
+#define F(s) ((const __FlashStringHelper *)(s))
+#define IRAM_ATTR
+#define ICACHE_RAM_ATTR
+
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+#define pgm_read_ptr(p) (*(void *const *)(p))
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+#define strlen_P strlen
+#define strcmp_P strcmp
+#define strcasecmp_P strcasecmp
+#define strncasecmp_P strncasecmp
+#define memcpy_P memcpy
+
+// avr-libc %S is a PROGMEM string, which is a plain string here
+static inline void Host_Format_P(char *Out, const char *Format)
+{
+  for (; *Format; Format++)
+  {
+    *Out++ = *Format;
+    if (*Format != '%')
+      continue;
+    Format++;
+    while (*Format && strchr("-+ #0123456789.lh", *Format))
+      *Out++ = *Format++;
+    if (!*Format)
+      break;
+    *Out++ = (*Format == 'S') ? 's' : *Format;
+  }
+  *Out = 0;
+}
+
+static inline int sprintf_P(char *Buffer, const char *Format, ...)
+{
+  char HostFormat[512];
+  va_list Args;
+  int Length;
+
+  Host_Format_P(HostFormat, Format);
+  va_start(Args, Format);
+  Length = vsprintf(Buffer, HostFormat, Args);
+  va_end(Args);
+  return Length;
+}
+
+static inline int snprintf_P(char *Buffer, size_t Size, const char *Format, ...)
+{
+  char HostFormat[512];
+  va_list Args;
+  int Length;
+
+  Host_Format_P(HostFormat, Format);
+  va_start(Args, Format);
+  Length = vsnprintf(Buffer, Size, HostFormat, Args);
+  va_end(Args);
+  return Length;
+}
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define CHANGE 3
+#define NOT_A_PIN 0
+#define D1 5
+#define D2 4
+#define D5 14
+#define D6 12
+#define D7 13
+#define D8 15
+
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(unsigned long);
+void delayMicroseconds(unsigned int);
+void yield(void);
+int digitalRead(uint8_t);
+void digitalWrite(uint8_t, uint8_t);
+void pinMode(uint8_t, uint8_t);
+void noInterrupts(void);
+void interrupts(void);
+int digitalPinToInterrupt(int);
+void attachInterrupt(int, void (*)(void), int);
+void detachInterrupt(int);
+
+struct HardwareSerial
+{
+  void begin(long);
+  int available(void);
+  int read(void);
+  int availableForWrite(void);
+  void flush(void);
+  size_t write(uint8_t);
+  size_t write(const uint8_t *, size_t);
+  size_t print(const char *);
+  size_t print(const __FlashStringHelper *);
+  size_t print(char);
+  size_t print(int);
+  size_t print(unsigned int);
+  size_t print(long);
+  size_t print(unsigned long);
+  size_t println(void);
+  size_t println(const char *);
+  size_t println(const __FlashStringHelper *);
+  size_t println(int);
+  size_t println(unsigned long);
+  size_t printf(const char *, ...);
+};
+extern HardwareSerial Serial;
+
+struct EspClass
+{
+  uint32_t getCycleCount(void);
+};
+extern EspClass ESP;
+
+#include "binary.h"
+
+#endif // Arduino_h
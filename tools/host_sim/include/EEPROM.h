@@ -0,0 +1,31 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Host stand-in for the ESP EEPROM emulation, a RAM array that counts its writes.
+
+#ifndef EEPROM_h
+#define EEPROM_h
+
+#include <Arduino.h>
+
+struct EEPROMClass
+{
+  uint8_t Data[4096];
+  unsigned long Writes; // bytes written, to check flash wear
+
+  void begin(size_t) {}
+  uint8_t read(int Address) { return Data[Address]; }
+  void write(int Address, uint8_t Value)
+  {
+    Data[Address] = Value;
+    Writes++;
+  }
+  bool commit(void) { return true; }
+};
+extern EEPROMClass EEPROM;
+
+#endif // EEPROM_h
@@ -0,0 +1,51 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Plugin_044 (Auriol V3) test: the sample of the plugin comment decodes, and the
+// gaps between the bits are accepted up to AURIOLV3_MIDHI (650 uSec) and no further.
+
+#include <Arduino.h>
+#include "Host.h"
+#include "2_Signal.h"
+#include "5_Plugin.h"
+#include "4_Display.h"
+
+// Sample from the Plugin_044 comment
+static const int Auriol_us[] = {475, 3850, 450, 1700, 450, 3825, 450, 3900, 450, 3725, 450, 3825, 450, 3825, 450,
+                                3900, 450, 3725, 450, 1700, 450, 1700, 450, 3900, 450, 3725, 450, 1700, 450, 1700,
+                                450, 1800, 450, 1625, 450, 3800, 450, 3825, 450, 1800, 450, 1625, 450, 1700, 450,
+                                1700, 450, 1800, 450, 3725, 450, 3800, 450, 1700, 450, 1800, 450, 1625, 450, 3825,
+                                450, 1700, 450, 3900, 450, 1625, 450, 1700, 450, 1700, 450, 3900, 450, 1625, 450,
+                                1700, 450, 1700, 450, 3825, 500, 5000};
+
+// The sample with one gap set to Gap samples, 0 keeps it as is
+static void Sample(byte Gap)
+{
+  static unsigned long Time = 1000;
+
+  Load(Auriol_us, sizeof(Auriol_us) / sizeof(Auriol_us[0]), Time += 1000); // not a repeat
+  if (Gap)
+    RawSignal.Pulses[41] = Gap;
+}
+
+int main(void)
+{
+  InitFrames();
+  PluginInit();
+
+  Sample(0);
+  Check("Auriol V3 sample", Decode(), 44);
+  EventText();
+  printf("%s", pbuffer);
+  Check("Auriol V3 sample text", strcmp(pbuffer + 6, "Auriol V3;ID=BF01;TEMP=00b6;HUM=81;\r\n") == 0);
+  Sample(650 / RAWSIGNAL_SAMPLE_RATE);
+  Check("gap of 640 uSec (20 samples)", Decode(), 44);
+  Sample(650 / RAWSIGNAL_SAMPLE_RATE + 1);
+  Check("gap of 672 uSec (21 samples)", Decode(), 0);
+
+  return Done();
+}
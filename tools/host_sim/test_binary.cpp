@@ -0,0 +1,215 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// SERIAL_BINARY test: events with fields of every format are written by the firmware
+// (SerialWriteEvent) and read back by tools/rflink_text (RFLinkBinary), which must give
+// the line EventText() prints in text mode. Then the decoder must drop a frame with a
+// wrong CRC, skip a frame of an unknown kind and resync after a stray 0xA5.
+
+#include <Arduino.h>
+#include "Host.h"
+#include "3_Serial.h"
+#include "4_Display.h"
+#include "../rflink_text/RFLinkBinary.h"
+
+static std::vector<std::string> Lines; // decoded
+
+static RFLinkBinary *NewDecoder(void)
+{
+  Lines.clear();
+  return new RFLinkBinary([](const std::string &Line) { Lines.push_back(Line); });
+}
+
+static void Feed(RFLinkBinary *Decoder, const std::string &Data)
+{
+  Decoder->Feed((const unsigned char *)Data.data(), Data.size());
+}
+
+// Writes the event in binary, decodes it and compares with the text line
+static void RoundTrip(RFLinkBinary *Decoder)
+{
+  std::string Binary;
+
+  EventText();
+  SerialCapture = &Binary;
+  SerialWriteEvent();
+  SerialCapture = NULL;
+  Lines.clear();
+  Feed(Decoder, Binary);
+  if ((Lines.size() != 1) || (Lines[0] != pbuffer))
+  {
+    printf("text:    %s", pbuffer);
+    printf("decoded: %s", Lines.empty() ? "(none)\n" : Lines[0].c_str());
+    Failed++;
+  }
+}
+
+int main(void)
+{
+  RFLinkBinary *Decoder = NewDecoder();
+  std::string Frame;
+
+  SerialBinary = true;
+
+  // Formats: HEX (TEMP...), DEC (HUM...), TEXT (IDc, SWITCHc), OKLOW (BAT), ONOFF (PIR, SMOKEALERT),
+  // CMD, VERSION (Splash), PLUGIN, NAME (FLEX), FLEXDEF
+  for (int Group = 0;; Group++)
+  {
+    display_Header();
+    switch (Group)
+    {
+    case 0:
+      display_Name(PSTR("Oregon TempHygro"));
+      display_IDn(0x1A2B, 4);
+      display_TEMP(0x80D2);
+      display_HUM(55, HUM_HEX);
+      display_BAT(false);
+      break;
+    case 1:
+      display_Name(PSTR("Oregon BTHR"));
+      display_IDc("0A1B2C");
+      display_BARO(1013);
+      display_HSTATUS(2);
+      display_BFORECAST(3);
+      display_HUM(0x55, HUM_BCD);
+      break;
+    case 2:
+      display_Name(PSTR("Rain"));
+      display_IDn(0x0102, 6);
+      display_UV(0x12);
+      display_LUX(0x1234);
+      display_RAIN(0x8D);
+      display_RAINRATE(7);
+      break;
+    case 3:
+      display_Name(PSTR("Wind"));
+      display_WINSP(123);
+      display_AWINSP(45);
+      display_WINGS(200);
+      display_WINDIR(15);
+      display_WINCHL(0x8010);
+      display_WINTMP(0x00FF);
+      break;
+    case 4:
+      display_Name(PSTR("Meter"));
+      display_CO2(450);
+      display_SOUND(65);
+      display_KWATT(0xABCD);
+      display_WATT(0x1F4);
+      display_CURRENT(12);
+      break;
+    case 5:
+      display_Name(PSTR("Meter"));
+      display_DIST(300);
+      display_METER(9999);
+      display_VOLT(230);
+      display_RGBW(0xF0F0);
+      break;
+    case 6:
+      display_Name(PSTR("Kaku"));
+      display_IDc("41");
+      display_SWITCH(1);
+      display_CMD(CMD_Single, CMD_On);
+      break;
+    case 7:
+      display_Name(PSTR("NewKaku"));
+      display_IDn(0x00CAFE, 8);
+      display_SWITCHc("B3");
+      display_CMD(CMD_All, CMD_Dim);
+      display_SET_LEVEL(12);
+      break;
+    case 8:
+      display_Name(PSTR("Alarm"));
+      display_CHIME(3);
+      display_SMOKEALERT(SMOKE_On);
+      display_PIR(PIR_Off);
+      display_BAT(true);
+      break;
+    case 9:
+      display_Splash();
+      break;
+    case 10:
+      display_PLUGIN(44, true);
+      break;
+    case 11:
+      display_FLEX(2);
+      display_VALUE(0x12345678);
+      break;
+    case 12:
+      display_FLEXDEF(1, "PWM,50,288,896,24,1,0-15,16-23,CRC8-31");
+      break;
+    case 13:
+      display_STATS(44, 123456, 789, 4242);
+      break;
+#ifdef EVENT_QUEUE
+    case 14:
+      display_QUEUE();
+      break;
+#endif
+    default:
+      Group = -1;
+    }
+    if (Group < 0)
+      break;
+    display_Footer();
+    RoundTrip(Decoder);
+  }
+  Check("round trip of every field format", Failed == 0);
+
+  // Wrong CRC: the event is dropped and counted, the same bytes decode once intact
+  delete Decoder;
+  Decoder = NewDecoder();
+  display_Header();
+  display_Name(PSTR("Auriol V3"));
+  display_IDc("BF01");
+  display_TEMP(0xB6);
+  display_Footer();
+  EventText();
+  SerialCapture = &Frame;
+  SerialWriteEvent(); // 'N' frame of the name then the 'E' frame
+  SerialCapture = NULL;
+  std::string Broken = Frame;
+  Broken[Broken.size() - 1] ^= 0x01;
+  Feed(Decoder, Broken);
+  Check("wrong CRC: no line", Lines.empty());
+  Check("wrong CRC: counted as bad frame", Decoder->BadFrames == 1);
+  Feed(Decoder, Frame);
+  Check("frame after a wrong CRC decodes", (Lines.size() == 1) && (Lines[0] == pbuffer));
+
+  // Unknown kind with a good CRC: A5 'X' 01 00 <CRC-8 of 'X' 01 00>, skipped without a line
+  unsigned char Unknown[] = {0xA5, 'X', 0x01, 0x00, 0x00};
+  unsigned char CRC = 0;
+  for (int y = 1; y < 4; y++)
+  {
+    CRC ^= Unknown[y];
+    for (int b = 0; b < 8; b++)
+      CRC = (CRC & 0x80) ? (CRC << 1) ^ 0x07 : (CRC << 1);
+  }
+  Unknown[4] = CRC;
+  delete Decoder;
+  Decoder = NewDecoder();
+  Feed(Decoder, std::string((const char *)Unknown, sizeof(Unknown)) + Frame);
+  Check("unknown kind: counted, not bad", (Decoder->UnknownFrames == 1) && (Decoder->BadFrames == 0));
+  Check("frame after an unknown kind decodes", (Lines.size() == 1) && (Lines[0] == pbuffer));
+
+  // Stray 0xA5 (noise on the line) right before a frame
+  delete Decoder;
+  Decoder = NewDecoder();
+  Feed(Decoder, "\xA5" + Frame);
+  Check("resync after a stray A5", (Lines.size() == 1) && (Lines[0] == pbuffer));
+
+  // Same, fed one byte at a time as read() may return them
+  delete Decoder;
+  Decoder = NewDecoder();
+  Frame = "20;00;Nodo RadioFrequencyLink - RFLink Gateway;\r\n\xA5" + Frame;
+  for (size_t x = 0; x < Frame.size(); x++)
+    Feed(Decoder, Frame.substr(x, 1));
+  Check("text line, stray A5, frame, byte by byte", (Lines.size() == 2) && (Lines[1] == pbuffer));
+
+  delete Decoder;
+  return Done();
+}
@@ -0,0 +1,65 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Capture test: replays bursts of 4 repeats of a 132 pulses frame through ScanEvent().
+// RF_ISR_CAPTURE must hand over every frame, as the gap that ends a repeat is also the
+// preamble of the next one. Polling restarts its preamble search after the end timeout
+// and only has to catch one repeat per burst. Prints the capture cost per edge.
+
+#include <Arduino.h>
+#include <time.h>
+#include <vector>
+#include "2_Signal.h"
+#include "2_Signal_Sim.h"
+#include "5_Plugin.h"
+
+int main(void)
+{
+  std::vector<unsigned long> Edges;
+  unsigned long Time = 1000;
+  unsigned long Sent = 0;
+  struct timespec Start, End;
+
+  for (int Burst = 0; Burst < 200; Burst++)
+  {
+    Time += 20000 + (Burst * 37) % 5000;
+    for (int Repeat = 0; Repeat < 4; Repeat++, Sent++)
+    {
+      Time += 9000; // preamble
+      Edges.push_back(Time);
+      for (int x = 0; x < 131; x++)
+      {
+        Time += (x % 2) ? (((x * 7) % 3) ? 1200 : 250) : 250;
+        Edges.push_back(Time);
+      }
+    }
+  }
+
+  InitFrames();
+  PluginInit();
+  Sim_Load(Edges.data(), Edges.size(), LOW);
+  clock_gettime(CLOCK_MONOTONIC, &Start);
+  while (!Sim_Done())
+    ScanEvent();
+  while (SimClock_us < Edges.back() + 2 * SIGNAL_END_TIMEOUT_US) // last frame ends on the timeout
+    ScanEvent();
+  clock_gettime(CLOCK_MONOTONIC, &End);
+
+  printf("capture: sent %lu frames, got %lu, %.1f polls/edge, %.1f ns/edge\n", Sent, SimFrames,
+         (double)SimPolls / Edges.size(),
+         ((End.tv_sec - Start.tv_sec) * 1e9 + (End.tv_nsec - Start.tv_nsec)) / Edges.size());
+#ifdef RF_ISR_CAPTURE
+  if (SimFrames != Sent)
+#else
+  if (SimFrames < Sent / 4)
+#endif
+  {
+    printf("FAIL: frames lost\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,137 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// SIGNAL_COMBINE test: three copies of the Plugin_044 sample, each with a different pulse
+// out of range, must decode once when combined. Copies that are too different must not be
+// combined. Then prints the share of bursts of 4 corrupted Auriol V2 copies that get
+// delivered, without (any copy decodes) and with SIGNAL_COMBINE.
+
+#include <Arduino.h>
+#include "Host.h"
+#include "2_Signal.h"
+#include "2_Signal_Sim.h"
+#include "4_Display.h"
+#include "5_Plugin.h"
+
+// Sample from the Plugin_044 comment
+static const int Auriol_us[] = {475, 3850, 450, 1700, 450, 3825, 450, 3900, 450, 3725, 450, 3825, 450, 3825, 450,
+                                3900, 450, 3725, 450, 1700, 450, 1700, 450, 3900, 450, 3725, 450, 1700, 450, 1700,
+                                450, 1800, 450, 1625, 450, 3800, 450, 3825, 450, 1800, 450, 1625, 450, 1700, 450,
+                                1700, 450, 1800, 450, 3725, 450, 3800, 450, 1700, 450, 1800, 450, 1625, 450, 3825,
+                                450, 1700, 450, 3900, 450, 1625, 450, 1700, 450, 1700, 450, 3900, 450, 1625, 450,
+                                1700, 450, 1700, 450, 3825, 500, 5000};
+
+static boolean Plain; // last frame decoded without SignalCombine()
+
+// What ScanEvent() does with a frame, 100 mSec after the previous one
+static byte Receive(void)
+{
+  int Number = RawSignal.Number;
+  boolean Decoded;
+
+  Sim_Advance(100000UL);
+  RawSignal.Time = millis();
+  EventClear();
+  Decoded = PluginRXCall(0, 0);
+  Plain = Decoded && Event.Complete;
+  if (!Decoded && (RawSignal.Number == Number))
+    Decoded = SignalCombine();
+  return (Decoded && Event.Complete) ? Event.Protocol : 0;
+}
+
+// The sample with the data pulse Bad out of range, between a 0 and a 1
+static void Sample(int Bad)
+{
+  Load(Auriol_us, sizeof(Auriol_us) / sizeof(Auriol_us[0]), 0);
+  RawSignal.Pulses[Bad] = 2700 / RAWSIGNAL_SAMPLE_RATE;
+}
+
+// Auriol V2 (Plugin_046), each pulse replaced by a random one with a probability of Rate / 1000
+static void AuriolV2(unsigned int Temperature, int Rate)
+{
+  unsigned long Bits1 = (0x5AUL << 16) | (1UL << 15) | (Temperature & 0xFFF);
+  unsigned long Bits2 = 0xF00;
+  int x = 2;
+
+  RawSignal.Number = 74;
+  RawSignal.Multiply = RAWSIGNAL_SAMPLE_RATE;
+  RawSignal.Pulses[0] = 0;
+  RawSignal.Pulses[1] = 15;
+  for (int b = 23; b >= 0; b--, x += 2)
+  {
+    RawSignal.Pulses[x] = ((Bits1 >> b) & 1) ? 54 : 25;
+    RawSignal.Pulses[x + 1] = 15;
+  }
+  for (int b = 11; b >= 0; b--, x += 2)
+  {
+    RawSignal.Pulses[x] = ((Bits2 >> b) & 1) ? 54 : 25;
+    RawSignal.Pulses[x + 1] = 15;
+  }
+  for (x = 1; x <= RawSignal.Number; x++)
+    if (rand() % 1000 < Rate)
+      RawSignal.Pulses[x] = 3 + rand() % 60;
+}
+
+int main(void)
+{
+  static const int Rates[] = {5, 15, 25, 30};
+
+  InitFrames();
+  PluginInit();
+
+  Sample(4);
+  Check("first corrupted copy", Receive(), 0);
+  Sample(20);
+  Check("second corrupted copy", Receive(), 0);
+  Sample(36);
+  Check("third corrupted copy, combined", Receive(), 44);
+  Check("combined, not decoded as is", !Plain);
+  Sample(52);
+  Check("fourth corrupted copy", Receive(), 0);
+
+  Sim_Advance(SIGNAL_COMBINE_MS * 1000UL); // kept copies are too old now
+  Sample(4);
+  Check("first copy", Receive(), 0);
+  Sample(20);
+  for (int x = 2; x < 2 + 2 * (SIGNAL_COMBINE_DIFF + 1); x += 2) // short/long swapped on too many pulses
+    RawSignal.Pulses[x] = (RawSignal.Pulses[x] > 2700 / RAWSIGNAL_SAMPLE_RATE) ? 1700 / RAWSIGNAL_SAMPLE_RATE : 3800 / RAWSIGNAL_SAMPLE_RATE;
+  Check("copy too different", Receive(), 0);
+  Sample(36);
+  Check("third copy, not combined", Receive(), 0);
+
+  srand(16);
+  printf("Auriol V2 bursts of 4 copies, each pulse corrupted with probability p:\n  p     ");
+  for (unsigned int r = 0; r < sizeof(Rates) / sizeof(Rates[0]); r++)
+    printf("%5.1f%%", Rates[r] / 10.0);
+  for (int Combine = 0; Combine < 2; Combine++)
+  {
+    printf(Combine ? "\n  on    " : "\n  off   ");
+    for (unsigned int r = 0; r < sizeof(Rates) / sizeof(Rates[0]); r++)
+    {
+      int Delivered = 0;
+
+      srand(16 + r); // same bursts in both rows
+      for (int Burst = 0; Burst < 1000; Burst++)
+      {
+        boolean Got = false;
+
+        Sim_Advance(SIGNAL_COMBINE_MS * 1000UL);
+        for (int Copy = 0; Copy < 4; Copy++)
+        {
+          AuriolV2(200 + Burst % 300, Rates[r]); // 20.0 to 49.9 degrees
+          byte Protocol = Receive();
+          Got |= Combine ? (Protocol != 0) : Plain;
+        }
+        Delivered += Got;
+      }
+      printf("%6.1f", Delivered / 10.0);
+    }
+  }
+  printf("  %% bursts delivered\n");
+
+  return Done();
+}
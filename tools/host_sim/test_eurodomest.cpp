@@ -0,0 +1,46 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Plugin_005 (Eurodomest) test: its PulseCodeStruct checks the pulse before the data pulse
+// (Other = -1), which must work where char is unsigned (ESP8266, ESP32). A code whose other
+// pulse would fall before Pulses[1], or after the last pulse, must not decode.
+
+#include <Arduino.h>
+#include "Host.h"
+#include "2_Signal.h"
+#include "4_Display.h"
+#include "5_Plugin.h"
+#include "5_Plugin_Decode.h"
+
+// Sample from the Plugin_005 comment, with the end pulse
+static const int Eurodomest_us[] = {900, 200, 825, 200, 225, 825, 200, 825, 800, 200, 200, 825, 200, 825, 825, 200, 225,
+                                    825, 800, 200, 800, 225, 225, 825, 800, 225, 200, 825, 225, 825, 800, 225, 225, 825,
+                                    800, 225, 200, 825, 200, 825, 225, 825, 225, 825, 225, 825, 800, 200, 200, 200};
+
+int main(void)
+{
+  PulseCodeStruct Code = {2, 24, 2, 400 / RAWSIGNAL_SAMPLE_RATE, 0, 400 / RAWSIGNAL_SAMPLE_RATE, 0xFF, -1, 0xFF, PULSECODE_OPPOSITE};
+  unsigned long Bits[2];
+
+  InitFrames();
+  PluginInit();
+
+  Load(Eurodomest_us, sizeof(Eurodomest_us) / sizeof(Eurodomest_us[0]), 1000);
+  Check("Eurodomest sample", Decode(), 5);
+  EventText();
+  printf("%s", pbuffer);
+
+  Load(Eurodomest_us, sizeof(Eurodomest_us) / sizeof(Eurodomest_us[0]), 5000);
+  Check("other pulse before the data pulse", PulseCodeDecodeRAM(&Code, Bits));
+  Code.First = 1;
+  Check("other pulse before Pulses[1]", !PulseCodeDecodeRAM(&Code, Bits));
+  Code.First = 2;
+  Code.Other = 3;
+  Check("other pulse after the last pulse", !PulseCodeDecodeRAM(&Code, Bits));
+
+  return Done();
+}
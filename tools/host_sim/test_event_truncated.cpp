@@ -0,0 +1,52 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Event record test: a message with more than EVENT_FIELDS fields or EVENT_TEXT_SIZE text
+// is marked Truncated and counted once in EventTruncated, a message that fits is not.
+
+#include <Arduino.h>
+#include "Host.h"
+#include "4_Display.h"
+
+static void CheckTruncated(const char *What, boolean Truncated, unsigned long Count)
+{
+  printf("Truncated %d (expected %d), EventTruncated %lu (expected %lu)\n", Event.Truncated, Truncated,
+         EventTruncated, Count);
+  Check(What, (Event.Truncated == Truncated) && (EventTruncated == Count));
+}
+
+int main(void)
+{
+  char Long[EVENT_TEXT_SIZE + 8];
+
+  display_Header();
+  display_Name(PSTR("Widest"));
+  for (byte x = 0; x < EVENT_FIELDS; x++)
+    display_TEMP(x);
+  display_Footer();
+  CheckTruncated("EVENT_FIELDS fields", false, 0);
+
+  display_Header();
+  for (byte x = 0; x <= EVENT_FIELDS + 2; x++)
+    display_TEMP(x);
+  display_Footer();
+  CheckTruncated("too many fields", true, 1);
+
+  memset(Long, 'A', sizeof(Long) - 1);
+  Long[sizeof(Long) - 1] = 0;
+  display_Header();
+  display_IDc(Long);
+  display_Footer();
+  CheckTruncated("text too long", true, 2);
+
+  display_Header();
+  display_IDc("0A1B");
+  display_Footer();
+  CheckTruncated("short text", false, 2);
+
+  return Done();
+}
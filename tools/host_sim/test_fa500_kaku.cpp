@@ -0,0 +1,51 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Ghost suppression test: Plugin_003 (Kaku) must drop a frame that comes less than
+// 2250 mSec after an FA500 frame decoded by Plugin_012, which never calls SignalRepeat().
+
+#include <Arduino.h>
+#include "Host.h"
+#include "2_Signal.h"
+#include "5_Plugin.h"
+#include "4_Display.h"
+
+// Kaku sample from the Plugin_012 comment, with the end pulse
+static const int Kaku_us[] = {3200, 875, 300, 875, 300, 875, 300, 875, 300, 875, 300, 875, 300, 875, 300,
+                              875, 300, 875, 300, 875, 300, 875, 300, 900, 275, 875, 300, 875, 300, 875,
+                              925, 250, 300, 875, 300, 875, 300, 875, 925, 250, 300, 875, 925, 250, 300,
+                              875, 300, 875, 300, 3200};
+
+// FA500 method 3: 12 bits on the even pulses, 875 uSec is a 1
+static void LoadFA500(unsigned long Time)
+{
+  unsigned long Bits = (1UL << 8) | (0x0A << 1) | 1;
+  int Pulses_us[26];
+
+  for (int x = 0; x < 26; x++)
+    Pulses_us[x] = 300;
+  for (int b = 0; b < 12; b++)
+    Pulses_us[1 + 2 * b] = ((Bits >> (11 - b)) & 1) ? 875 : 300;
+  Load(Pulses_us, 26, Time);
+}
+
+int main(void)
+{
+  InitFrames();
+  PluginInit();
+
+  Load(Kaku_us, 50, 1000);
+  Check("Kaku alone", Decode(), 3);
+  LoadFA500(10000);
+  Check("FA500", Decode(), 12);
+  Load(Kaku_us, 50, 10500);
+  Check("Kaku 500 mSec later", Decode(), 0);
+  Load(Kaku_us, 50, 13500);
+  Check("Kaku 3500 mSec later", Decode(), 3);
+
+  return Done();
+}
@@ -0,0 +1,106 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Flex decoder test: 10;FLEXn=...; definitions that are accepted, and shown back as parsed,
+// definitions that are rejected and leave the slot as it was, slots of EEPROM that hold no
+// valid definition are cleared by FlexLoad(), and a PWM frame decodes with its definition.
+
+#include <Arduino.h>
+#include <EEPROM.h>
+#include "Host.h"
+#include "2_Signal.h"
+#include "4_Display.h"
+#include "5_Plugin.h"
+#include "5_Plugin_Flex.h"
+
+#define FLEX_SLOT_SIZE 16 // sizeof(FlexStruct)
+
+// Runs 10;FLEX<Slot><Definition>; and checks the answer, NULL when the command must fail
+static void Command(byte Slot, const char *Definition, const char *Answer)
+{
+  char Text[INPUT_COMMAND_SIZE];
+  char What[INPUT_COMMAND_SIZE + 8];
+  boolean Done;
+
+  snprintf(What, sizeof(What), "FLEX%d%s", Slot, Definition ? Definition : "");
+  if (Definition != NULL)
+    strcpy(Text, Definition);
+  display_Header();
+  Done = FlexCommand(Slot, (Definition != NULL) ? Text : NULL);
+  display_Footer();
+  EventText();
+  if (Answer == NULL)
+    Check(What, !Done);
+  else
+  {
+    printf("%s", pbuffer);
+    Check(What, Done && (strncmp(pbuffer + 6, "FLEX", 4) == 0) && (strstr(pbuffer, Answer) != NULL));
+  }
+}
+
+// PWM: bit in the first pulse of each pair, 896 uSec is a 1, 288 uSec gaps, then the end gap
+static void LoadPWM(unsigned long Bits, int Count, unsigned long Time)
+{
+  int Pulses_us[RAW_BUFFER_SIZE];
+  int x = 0;
+
+  for (int b = Count - 1; b >= 0; b--)
+  {
+    Pulses_us[x++] = ((Bits >> b) & 1) ? 896 : 288;
+    Pulses_us[x++] = 288;
+  }
+  Pulses_us[x++] = 288;
+  Pulses_us[x++] = 5000;
+  Load(Pulses_us, x, Time);
+}
+
+int main(void)
+{
+  InitFrames();
+  PluginInit();
+
+  Command(1, "=PWM,50,288,896,24,1,0-15,16-23", "=PWM,50,288,896,24,1,0-15,16-23;");
+  Command(2, "=ppm,40-60,0,0,32LI,2,,0-31,CRC8-31", "=PPM,40-60,0,0,32LI,2,,0-31,CRC8-31;");
+  Command(3, "=MAN,100,480,960,64,1,0-31,32-63,PAR", "=MAN,100,480,960,64,1,0-31,32-63,PAR;");
+  Command(1, NULL, "=PWM,50,288,896,24,1,0-15,16-23;");
+
+  Command(1, "=FSK,50,288,896,24,1,0-15,16-23", NULL);
+  Command(1, "=PWM,50,896,288,24,1,0-15,16-23", NULL);   // short longer than long
+  Command(1, "=PWM,50,288,0,24,1,0-15,16-23", NULL);     // one length from the clock
+  Command(1, "=PWM,50,288,896,0,1,0-15,16-23", NULL);    // no bits
+  Command(1, "=PWM,50,288,896,65,1,0-15,16-23", NULL);   // more than 64 bits
+  Command(1, "=PWM,50,288,896,24,256,0-15,16-23", NULL); // first past a byte
+  Command(1, "=PWM,50,288,896,24,1,0-24,", NULL);        // id past the last bit
+  Command(1, "=PWM,50,288,896,24,1,,0-32", NULL);        // value of 33 bits
+  Command(1, "=PWM,50,288,896,24,1,0-15,16-23,CRC8-0", NULL);
+  Command(1, "=PWM,50,288,896,24,1,0-15,16-23,CRC8-100", NULL);
+  Command(1, "=PWM,50,288,896,24,1,0-15,16-23,CRC8-G", NULL);
+  Command(1, "=PWM,50,288,896,24,1,0-15,16-23,SUM", NULL);
+  Command(0, "=PWM,50,288,896,24,1,0-15,16-23", NULL);
+  Command(FLEX_SLOTS + 1, "=PWM,50,288,896,24,1,0-15,16-23", NULL);
+  Command(1, NULL, "=PWM,50,288,896,24,1,0-15,16-23;"); // unchanged by the rejected ones
+
+  unsigned long Writes = EEPROM.Writes;
+  Command(1, "=PWM,50,288,896,24,1,0-15,16-23", "=PWM,50,288,896,24,1,0-15,16-23;");
+  Check("same definition again: no EEPROM write", EEPROM.Writes == Writes);
+
+  // Slot 2 gets a mode that does not exist, slot 3 a bit count of 0
+  EEPROM.Data[FLEX_EEPROM_ADDR + 1 + FLEX_SLOT_SIZE] = 0x07;
+  EEPROM.Data[FLEX_EEPROM_ADDR + 1 + 2 * FLEX_SLOT_SIZE + 8] = 0;
+  PluginInit(); // FlexLoad()
+  Command(1, NULL, "=PWM,50,288,896,24,1,0-15,16-23;");
+  Command(2, NULL, "=OFF;");
+  Command(3, NULL, "=OFF;");
+
+  LoadPWM(0xCAFE5A, 24, 1000);
+  Check("PWM frame", Decode(), FLEX_PLUGIN_ID);
+  EventText();
+  printf("%s", pbuffer);
+  Check("PWM frame text", strcmp(pbuffer + 6, "Flex1;ID=cafe;VALUE=5a;\r\n") == 0);
+
+  return Done();
+}
@@ -0,0 +1,33 @@
+# Widest message of the plugins: most display_* fields between a display_Header() and the
+# next display_Footer(). Branches are all counted, so this is an upper bound.
+# Prints "<fields> <file>" for the widest one.
+
+FNR == 1 { Open = 0 }
+
+{
+  Line = $0
+  sub(/\/\/.*/, "", Line)
+  while (match(Line, /display_[A-Za-z_]+\(/))
+  {
+    Call = substr(Line, RSTART + 8, RLENGTH - 9)
+    Line = substr(Line, RSTART + RLENGTH)
+    if (Call == "Header")
+    {
+      Open = 1
+      Fields = 0
+    }
+    else if (Call == "Footer")
+    {
+      if (Open && (Fields > Widest))
+      {
+        Widest = Fields
+        File = FILENAME
+      }
+      Open = 0
+    }
+    else if (Open && (Call != "Name"))
+      Fields++
+  }
+}
+
+END { print Widest, File }
@@ -0,0 +1,260 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#include "RFLinkBinary.h"
+#include "../../RFLink/4_Display_Types.h"
+#include <stdio.h>
+
+// Indexed by EVENT_Type, from the list the firmware uses
+static const struct
+{
+  const char *Label;
+  EVENT_Format Kind;
+} Types[] = {
+#define EVENT_TYPE(Name, Label, Format, Kind, Json) {Label, FORMAT_##Format},
+    EVENT_TYPES
+#undef EVENT_TYPE
+};
+static const size_t TypeCount = sizeof(Types) / sizeof(Types[0]);
+
+static std::string Number(const char *Format, int Digits, unsigned long Value)
+{
+  char Text[24];
+
+  snprintf(Text, sizeof(Text), Format, Digits, Value);
+  return Text;
+}
+
+RFLinkBinary::RFLinkBinary(LineHandler Handler) : Handler(Handler)
+{
+}
+
+// A5 <kind> <length> <payload> <CRC-8>, anything else is text
+void RFLinkBinary::Feed(const unsigned char *Data, size_t Length)
+{
+  Bytes += Length;
+  for (size_t x = 0; x < Length; x++)
+  {
+    if (Buffer.empty() && (Data[x] != 0xA5))
+    {
+      Text += (char)Data[x];
+      if (Data[x] == '\n')
+      {
+        Handler(Text);
+        Text.clear();
+      }
+      continue;
+    }
+    Buffer.push_back(Data[x]);
+    if ((Buffer.size() == 2) && ((Buffer[1] < 'A') || (Buffer[1] > 'Z')))
+    { // kinds are capital letters: the A5 was noise or text, no need to wait for a length
+      Resync();
+      continue;
+    }
+    if ((Buffer.size() < 3) || (Buffer.size() < 4 + (size_t)Buffer[2]))
+      continue;
+
+    unsigned char CRC = 0;
+    for (size_t y = 1; y < Buffer.size() - 1; y++)
+    {
+      CRC ^= Buffer[y];
+      for (int b = 0; b < 8; b++)
+        CRC = (CRC & 0x80) ? (CRC << 1) ^ 0x07 : (CRC << 1);
+    }
+    if (CRC == Buffer.back())
+    {
+      Frame(Buffer[1], &Buffer[3], Buffer[2]);
+      Buffer.clear();
+    }
+    else
+    {
+      BadFrames++;
+      Resync();
+    }
+  }
+}
+
+// Not a frame after all: drop the A5, look for the next one in what was taken for a frame
+void RFLinkBinary::Resync(void)
+{
+  std::vector<unsigned char> Rest(Buffer.begin() + 1, Buffer.end());
+
+  Buffer.clear();
+  Feed(Rest.data(), Rest.size());
+  Bytes -= Rest.size();
+}
+
+void RFLinkBinary::Frame(char Kind, const unsigned char *Payload, size_t Length)
+{
+  bool Good = false;
+
+  switch (Kind)
+  {
+  case 'N':
+    if ((Good = (Length >= 1)))
+      Names[Payload[0]].assign((const char *)Payload + 1, Length - 1);
+    break;
+  case 'E':
+    Good = Event(Payload, Length);
+    break;
+  case 'P':
+    Good = Pulses(Payload, Length);
+    break;
+  default: // the CRC is right, so the stream is in sync: skip the frame
+    UnknownFrames++;
+    return;
+  }
+  if (Good)
+    Frames++;
+  else
+    BadFrames++;
+}
+
+// <sequence> <Plugin_id> <name code> then the fields
+bool RFLinkBinary::Event(const unsigned char *Payload, size_t Length)
+{
+  std::string Line = "20;";
+  size_t x = 3;
+
+  if (Length < 3)
+    return false;
+  Line += Number("%0*lX", 2, Payload[0]);
+  if (Payload[2] != 0xFF)
+    Line += ";" + Names[Payload[2]];
+
+  while (x + 2 <= Length)
+  {
+    unsigned char Type = Payload[x++];
+    unsigned char Size = Payload[x++];
+    unsigned long Value = 0;
+    int Digits = 1;
+    std::string FieldText;
+
+    if (Type >= TypeCount)
+      return false;
+    if ((Types[Type].Kind == FORMAT_TEXT) || (Types[Type].Kind == FORMAT_FLEXDEF))
+    { // <text length> <low byte of value> <text>
+      if (x + 1 + Size > Length)
+        return false;
+      Value = Payload[x++];
+      FieldText.assign((const char *)Payload + x, Size);
+      x += Size;
+    }
+    else
+    { // <digits << 4 | value bytes> <value, LSB first>
+      if (((Size & 0x0F) > 4) || (x + (Size & 0x0F) > Length))
+        return false;
+      Digits = Size >> 4;
+      for (int b = 0; b < (Size & 0x0F); b++)
+        Value |= (unsigned long)Payload[x++] << (8 * b);
+    }
+
+    Line += ";";
+    if (Types[Type].Kind == FORMAT_VERSION)
+      Line += "RFLink_ESP;";
+    Line += Types[Type].Label;
+    switch (Types[Type].Kind)
+    {
+    case FORMAT_NAME: // Flex1
+      Line += Number("%0*lu", Digits, Value);
+      continue;
+    case FORMAT_PLUGIN: // PLUGIN004=ON
+      Line += Number("%0*lu", Digits, Value & 0xFF) + ((Value >> 8) ? "=ON" : "=OFF");
+      continue;
+    case FORMAT_FLEXDEF: // FLEX1=PWM,...
+      Line += Number("%0*lu", 1, Value) + "=" + FieldText;
+      continue;
+    default:
+      Line += "=";
+    }
+    switch (Types[Type].Kind)
+    {
+    case FORMAT_HEX:
+      Line += Number("%0*lx", Digits, Value);
+      break;
+    case FORMAT_DEC:
+      Line += Number("%0*lu", Digits, Value);
+      break;
+    case FORMAT_TEXT:
+      Line += FieldText;
+      break;
+    case FORMAT_ONOFF:
+      Line += Value ? "ON" : "OFF";
+      break;
+    case FORMAT_OKLOW:
+      Line += Value ? "OK" : "LOW";
+      break;
+    case FORMAT_VERSION:
+      Line += Number("%0*lu", 1, Value >> 8) + "." + Number("%0*lu", 1, Value & 0xFF);
+      break;
+    case FORMAT_CMD:
+      if ((Value >> 8) == CMD_All)
+        Line += "ALL";
+      switch (Value & 0xFF)
+      {
+      case CMD_On:
+        Line += "ON";
+        break;
+      case CMD_Off:
+        Line += "OFF";
+        break;
+      case CMD_Bright:
+        Line += "BRIGHT";
+        break;
+      case CMD_Dim:
+        Line += "DIM";
+        break;
+      case CMD_Unknown:
+      default:
+        Line += "UNKNOWN";
+      }
+      break;
+    default:
+      break;
+    }
+  }
+  if (x != Length)
+    return false;
+  Handler(Line + ";\r\n");
+  return true;
+}
+
+// <flags> <uSec per sample> <number:2> <first:2> <samples>, the line goes out with its last sample
+bool RFLinkBinary::Pulses(const unsigned char *Payload, size_t Length)
+{
+  if (Length < 6)
+    return false;
+
+  bool Hex = Payload[0] & 1;
+  unsigned int Rate = Payload[1];
+  unsigned int Count = Payload[2] | (Payload[3] << 8);
+  unsigned int First = Payload[4] | (Payload[5] << 8);
+
+  if (First == 1)
+    PulsesLine = "20;XX;DEBUG;Pulses=" + Number("%0*lu", 1, Count) + ";Pulses(uSec)=";
+  else if (PulsesLine.empty())
+    return true; // started receiving in the middle of a dump
+  for (size_t x = 6; x < Length; x++)
+  {
+    unsigned int i = First + x - 6;
+
+    if (Hex)
+      PulsesLine += Number("%0*lx", 2, Payload[x]);
+    else
+    {
+      PulsesLine += Number("%0*lu", 1, (unsigned long)Payload[x] * Rate);
+      if (i < Count)
+        PulsesLine += ",";
+    }
+  }
+  if (First + Length - 6 > Count)
+  {
+    Handler(PulsesLine + ";\r\n");
+    PulsesLine.clear();
+  }
+  return true;
+}
@@ -0,0 +1,46 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef RFLinkBinary_h
+#define RFLinkBinary_h
+
+// ***********************************************************************************
+// Host side decoder of the SERIAL_BINARY frames (see RFLink/3_Serial.h): turns them back
+// into the 20;xx;... lines RFLink prints in text mode. Text lines that arrive before
+// 10;BINARY=ON; (start message, ...) are passed on as they are.
+// ***********************************************************************************
+#include <functional>
+#include <string>
+#include <vector>
+
+class RFLinkBinary
+{
+public:
+  typedef std::function<void(const std::string &Line)> LineHandler; // Line ends with \r\n
+
+  explicit RFLinkBinary(LineHandler Handler);
+  void Feed(const unsigned char *Data, size_t Length);
+
+  unsigned long Frames = 0;        // frames decoded
+  unsigned long BadFrames = 0;     // frames with a wrong CRC or layout, skipped
+  unsigned long UnknownFrames = 0; // good frames of a kind this decoder does not know (newer firmware), skipped
+  unsigned long Bytes = 0;         // bytes received
+
+private:
+  void Resync(void);
+  void Frame(char Kind, const unsigned char *Payload, size_t Length);
+  bool Event(const unsigned char *Payload, size_t Length);
+  bool Pulses(const unsigned char *Payload, size_t Length);
+
+  LineHandler Handler;
+  std::vector<unsigned char> Buffer; // frame being received
+  std::string Text;                  // text line being received
+  std::string PulsesLine;            // debug dump being received in 'P' frames
+  std::string Names[256];            // by name code
+};
+
+#endif // RFLinkBinary_h
@@ -0,0 +1,49 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// rflink_text: SERIAL_BINARY frames in, classic 20;xx;... lines out
+//
+//   g++ -O2 -o rflink_text rflink_text.cpp RFLinkBinary.cpp
+//   stty -F /dev/ttyUSB0 57600 raw -echo
+//   (echo "10;BINARY=ON;" > /dev/ttyUSB0) ; ./rflink_text /dev/ttyUSB0
+//
+// Reads the file given (serial port, capture) or stdin, writes the lines to stdout as soon
+// as their frame is complete and, at the end, the number of bytes and frames to stderr.
+// The decoder is tested against the firmware encoder by make -C tools/host_sim test.
+
+#include "RFLinkBinary.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+
+int main(int argc, char **argv)
+{
+  int In = STDIN_FILENO;
+  unsigned char Data[256];
+  ssize_t Length;
+
+  if ((argc > 1) && ((In = open(argv[1], O_RDONLY)) < 0))
+  {
+    perror(argv[1]);
+    return 1;
+  }
+
+  RFLinkBinary Decoder([](const std::string &Line) {
+    fwrite(Line.data(), 1, Line.size(), stdout);
+    fflush(stdout);
+  });
+
+  // read() returns what has arrived, a serial port gives a few bytes at a time
+  while ((Length = read(In, Data, sizeof(Data))) > 0)
+    Decoder.Feed(Data, Length);
+  if (Length < 0)
+    perror("read");
+
+  fprintf(stderr, "%lu bytes, %lu frames, %lu bad frames, %lu unknown frames\n", Decoder.Bytes, Decoder.Frames,
+          Decoder.BadFrames, Decoder.UnknownFrames);
+  return (Length < 0);
+}